@@ -0,0 +1,149 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace stlcontainer
+{
+namespace bench
+{
+
+// Keeps the optimizer from discarding a computed value
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Wall-clock milliseconds for one call of fn
+template<typename Function>
+double time_ms(Function&& fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Best of runs, filters out scheduler and page-fault noise
+template<typename Function>
+double best_of_ms(size_t runs, Function&& fn)
+{
+    double best = time_ms(fn);
+    for (size_t run = 1; run < runs; ++run)
+    {
+        auto curr = time_ms(fn);
+        best = curr < best ? curr : best;
+    }
+    return best;
+}
+
+inline void print_header(const char* title)
+{
+    std::printf("\n%s\n", title);
+    std::printf("%-40s %12s\n", "case", "ms");
+}
+
+inline void print_row(const char* name, double ms)
+{
+    std::printf("%-40s %12.3f\n", name, ms);
+}
+
+// Header and row for per-element cost tables: wall time plus nanoseconds per element
+inline void print_cost_header(const char* title)
+{
+    std::printf("\n%s\n", title);
+    std::printf("%-40s %12s %12s\n", "case", "ms", "ns/elem");
+}
+
+inline void print_cost_row(const char* name, double ms, double elements)
+{
+    std::printf("%-40s %12.3f %12.2f\n", name, ms, ms * 1000000.0 / elements);
+}
+
+// Header and row for throughput tables: wall time plus millions of operations per second
+inline void print_throughput_header(const char* title)
+{
+    std::printf("\n%s\n", title);
+    std::printf("%-40s %12s %12s\n", "case", "ms", "Mops/s");
+}
+
+inline void print_throughput_row(const char* name, double ms, double operations)
+{
+    std::printf("%-40s %12.3f %12.2f\n", name, ms, operations / ms / 1000.0);
+}
+
+// Runs fn(thread_index) on count threads released together, wall-clock ms until the last one finishes
+template<typename Function>
+double run_threads_ms(size_t count, Function&& fn)
+{
+    std::atomic<size_t> ready(0);
+    std::atomic<bool> start(false);
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < count; ++index)
+    {
+        threads.emplace_back([&, index] {
+            ++ready;
+            while (!start.load(std::memory_order_acquire))
+            {
+            }
+            fn(index);
+        });
+    }
+    while (ready.load() != count)
+    {
+    }
+
+    return time_ms([&] {
+        start.store(true, std::memory_order_release);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    });
+}
+
+// Pins the calling thread to one CPU. False where affinity is unsupported or the CPU does not exist.
+inline bool pin_to_core(size_t core)
+{
+#if defined(__linux__)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core, &cpus);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+// Header and row for latency tables: percentiles of samples in nanoseconds
+inline void print_latency_header(const char* title)
+{
+    std::printf("\n%s\n", title);
+    std::printf("%-40s %10s %10s %10s %10s\n", "case", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+}
+
+// Sorts samples
+inline void print_latency_row(const char* name, std::vector<double>& samples)
+{
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double fraction) {
+        return samples[static_cast<size_t>(fraction * (samples.size() - 1))];
+    };
+    std::printf("%-40s %10.0f %10.0f %10.0f %10.0f\n", name, percentile(0.5), percentile(0.99), percentile(0.999),
+        samples.back());
+}
+
+} // namespace bench
+} // namespace stlcontainer
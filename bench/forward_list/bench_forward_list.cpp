@@ -0,0 +1,477 @@
+#include <algorithm>
+#include <cstring>
+#include <forward_list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "../Benchmark.h"
+#include "forward_list/ConcurrentForwardList.h"
+#include "forward_list/ForwardList.h"
+#include "forward_list/UnrolledForwardList.h"
+#include "vector/Vector.h"
+
+namespace
+{
+
+const size_t LIST_SIZE = 1000000;
+const size_t RUNS = 5;
+
+// Build, traverse and destroy phases timed separately, best of RUNS each
+template<typename List>
+void bench_build_traverse_destroy(const char* name)
+{
+    using stlcontainer::bench::best_of_ms;
+    using stlcontainer::bench::do_not_optimize;
+
+    std::unique_ptr<List> list;
+    double build = 0;
+    double traverse = 0;
+    double destroy = 0;
+    for (size_t run = 0; run < RUNS; ++run)
+    {
+        auto curr_build = stlcontainer::bench::time_ms([&] {
+            list.reset(new List());
+            for (size_t index = 0; index < LIST_SIZE; ++index)
+            {
+                list->push_front(static_cast<int>(index));
+            }
+        });
+
+        auto curr_traverse = best_of_ms(RUNS, [&] {
+            long sum = 0;
+            for (auto iter = list->begin(); iter != list->end(); ++iter)
+            {
+                sum += *iter;
+            }
+            do_not_optimize(sum);
+        });
+
+        auto curr_destroy = stlcontainer::bench::time_ms([&] { list.reset(); });
+
+        build = (run == 0 || curr_build < build) ? curr_build : build;
+        traverse = (run == 0 || curr_traverse < traverse) ? curr_traverse : traverse;
+        destroy = (run == 0 || curr_destroy < destroy) ? curr_destroy : destroy;
+    }
+
+    std::printf("%s\n", name);
+    stlcontainer::bench::print_row("  build (push_front x 1M)", build);
+    stlcontainer::bench::print_row("  traverse", traverse);
+    stlcontainer::bench::print_row("  destroy", destroy);
+}
+
+const size_t SORT_SIZE = 10000000;
+
+template<typename List>
+void fill_shuffled(List& list, size_t count)
+{
+    std::mt19937 gen(42);
+    for (size_t index = 0; index < count; ++index)
+    {
+        list.push_front(static_cast<int>(gen()));
+    }
+}
+
+void bench_sort()
+{
+    using stlcontainer::bench::time_ms;
+    using stlcontainer::bench::print_row;
+
+    {
+        stlcontainer::ForwardList<int> list;
+        fill_shuffled(list, SORT_SIZE);
+        print_row("ForwardList::sort (relink in place)", time_ms([&] { list.sort(); }));
+    }
+    {
+        // Baseline: copy values out, std::sort, write them back in list order
+        stlcontainer::ForwardList<int> list;
+        fill_shuffled(list, SORT_SIZE);
+        print_row("copy to vector + std::sort + write back", time_ms([&] {
+            std::vector<int> values(list.begin(), list.end());
+            std::sort(values.begin(), values.end());
+            auto valueIter = values.begin();
+            for (auto& elem : list)
+            {
+                elem = *valueIter++;
+            }
+        }));
+    }
+    {
+        std::forward_list<int> list;
+        fill_shuffled(list, SORT_SIZE);
+        print_row("std::forward_list::sort", time_ms([&] { list.sort(); }));
+    }
+}
+
+const size_t EDIT_SIZE = 20000;
+
+// Sum over every element, best of RUNS
+template<typename List>
+double traverse_ms(const List& list)
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [&] {
+        long sum = 0;
+        for (const auto& elem : list)
+        {
+            sum += elem;
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+void bench_unrolled_traverse()
+{
+    using stlcontainer::bench::print_row;
+
+    {
+        stlcontainer::ForwardList<int> list;
+        fill_shuffled(list, LIST_SIZE);
+        print_row("ForwardList, allocation order", traverse_ms(list));
+
+        // Sorting relinks the nodes, so list order no longer follows address order
+        list.sort();
+        print_row("ForwardList, scattered (after sort)", traverse_ms(list));
+    }
+    {
+        stlcontainer::UnrolledForwardList<int> list;
+        fill_shuffled(list, LIST_SIZE);
+        print_row("UnrolledForwardList", traverse_ms(list));
+    }
+    {
+        stlcontainer::Vector<int> vector;
+        std::mt19937 gen(42);
+        for (size_t index = 0; index < LIST_SIZE; ++index)
+        {
+            vector.push_back(static_cast<int>(gen()));
+        }
+        print_row("Vector", stlcontainer::bench::best_of_ms(RUNS, [&] {
+            long sum = 0;
+            for (size_t index = 0; index < vector.size(); ++index)
+            {
+                sum += vector[index];
+            }
+            stlcontainer::bench::do_not_optimize(sum);
+        }));
+    }
+}
+
+// EDIT_SIZE inserts at random positions into a list of EDIT_SIZE, each position reached by walking from the front
+template<typename List>
+double random_inserts_ms()
+{
+    List list;
+    fill_shuffled(list, EDIT_SIZE);
+    std::mt19937 gen(7);
+    return stlcontainer::bench::time_ms([&] {
+        for (size_t size = EDIT_SIZE; size < 2 * EDIT_SIZE; ++size)
+        {
+            list.insert_after(std::next(list.before_begin(), gen() % (size + 1)), static_cast<int>(size));
+        }
+    });
+}
+
+// EDIT_SIZE erases at random positions from a list of 2 * EDIT_SIZE
+template<typename List>
+double random_erases_ms()
+{
+    List list;
+    fill_shuffled(list, 2 * EDIT_SIZE);
+    std::mt19937 gen(7);
+    return stlcontainer::bench::time_ms([&] {
+        for (size_t size = 2 * EDIT_SIZE; size > EDIT_SIZE; --size)
+        {
+            list.erase_after(std::next(list.before_begin(), gen() % size));
+        }
+    });
+}
+
+// One pass erasing every other element of LIST_SIZE
+template<typename List>
+double erase_pass_ms()
+{
+    List list;
+    fill_shuffled(list, LIST_SIZE);
+    return stlcontainer::bench::time_ms([&] {
+        for (auto iter = list.begin(); iter != list.end() && std::next(iter) != list.end(); )
+        {
+            iter = list.erase_after(iter);
+        }
+    });
+}
+
+void bench_unrolled_edit()
+{
+    using stlcontainer::bench::print_row;
+    using Unrolled = stlcontainer::UnrolledForwardList<int>;
+    std::mt19937 gen(7);
+
+    std::printf("random inserts, %zu into %zu\n", EDIT_SIZE, EDIT_SIZE);
+    print_row("  ForwardList", random_inserts_ms<stlcontainer::ForwardList<int>>());
+    print_row("  UnrolledForwardList", random_inserts_ms<Unrolled>());
+    {
+        // stlcontainer::Vector has no insert yet, std::vector stands in for the contiguous case
+        std::vector<int> vector(EDIT_SIZE);
+        print_row("  std::vector::insert", stlcontainer::bench::time_ms([&] {
+            for (size_t size = EDIT_SIZE; size < 2 * EDIT_SIZE; ++size)
+            {
+                vector.insert(vector.begin() + gen() % (size + 1), static_cast<int>(size));
+            }
+        }));
+    }
+
+    std::printf("random erases, %zu from %zu\n", EDIT_SIZE, 2 * EDIT_SIZE);
+    print_row("  ForwardList", random_erases_ms<stlcontainer::ForwardList<int>>());
+    print_row("  UnrolledForwardList", random_erases_ms<Unrolled>());
+    {
+        std::vector<int> vector(2 * EDIT_SIZE);
+        print_row("  std::vector::erase", stlcontainer::bench::time_ms([&] {
+            for (size_t size = 2 * EDIT_SIZE; size > EDIT_SIZE; --size)
+            {
+                vector.erase(vector.begin() + gen() % size);
+            }
+        }));
+    }
+
+    std::printf("erase every other element, %zu\n", LIST_SIZE);
+    print_row("  ForwardList", erase_pass_ms<stlcontainer::ForwardList<int>>());
+    print_row("  UnrolledForwardList", erase_pass_ms<Unrolled>());
+    {
+        std::vector<int> vector(LIST_SIZE);
+        print_row("  std::vector, erase(remove_if)", stlcontainer::bench::time_ms([&] {
+            size_t index = 0;
+            vector.erase(std::remove_if(vector.begin(), vector.end(), [&](int) { return index++ % 2 == 0; }), vector.end());
+        }));
+    }
+}
+
+// 24M nodes of 16 bytes, 384 MB: larger than the last-level cache, so every traversal streams from memory
+const size_t PREFETCH_SIZE = 24000000;
+
+// Shuffled ints, sorted so that list order is scattered across the pool instead of following allocation
+// order. Values are folded into [0, 1000) first, which gives unique() long runs to remove.
+template<typename List>
+void fill_scattered(List& list)
+{
+    std::mt19937 gen(42);
+    for (size_t index = 0; index < PREFETCH_SIZE; ++index)
+    {
+        list.push_front(static_cast<int>(gen() % 1000));
+    }
+    list.sort();
+}
+
+// The pre-prefetch algorithm, one node at a time through the public interface: test the next node, erase
+// it or step onto it
+template<typename List, typename UnaryPredicate>
+void remove_node_by_node(List& list, UnaryPredicate pred)
+{
+    auto iter = list.before_begin();
+    for (auto next = std::next(iter); next != list.end(); next = std::next(iter))
+    {
+        if (pred(*next))
+        {
+            list.erase_after(iter);
+        } else {
+            iter = next;
+        }
+    }
+}
+
+// Stands in for a predicate that does real work per element, roughly the latency of one cache miss
+bool costly_is_odd(int value)
+{
+    unsigned hash = static_cast<unsigned>(value);
+    for (unsigned round = 0; round < 100; ++round)
+    {
+        hash = hash * 2654435761u + round;
+    }
+    return (hash ^ static_cast<unsigned>(value)) % 2 != 0;
+}
+
+void bench_prefetch()
+{
+    using stlcontainer::bench::do_not_optimize;
+    using stlcontainer::bench::print_row;
+    using stlcontainer::bench::time_ms;
+    using List = stlcontainer::ForwardList<int>;
+    auto is_odd = [](int value) { return value % 2 != 0; };
+
+    // Traversals that match nothing, so one list serves every case. The sums keep the loops alive.
+    {
+        List list;
+        fill_scattered(list);
+        long sum = 0;
+        auto summing = [&sum](int value) { sum += value; return false; };
+        auto costly_summing = [&sum](int value) { sum += costly_is_odd(value); return false; };
+
+        print_row("traverse, iterator loop", time_ms([&] {
+            for (auto elem : list)
+            {
+                sum += elem;
+            }
+        }));
+        print_row("traverse, node by node", time_ms([&] { remove_node_by_node(list, summing); }));
+        print_row("traverse, remove_if", time_ms([&] { list.remove_if(summing); }));
+        print_row("costly predicate, node by node", time_ms([&] { remove_node_by_node(list, costly_summing); }));
+        print_row("costly predicate, remove_if", time_ms([&] { list.remove_if(costly_summing); }));
+        do_not_optimize(sum);
+    }
+
+    // Half the nodes are freed. Copying would allocate in list order, so each case builds its own scattered list.
+    {
+        List list;
+        fill_scattered(list);
+        print_row("remove odd, node by node", time_ms([&] { remove_node_by_node(list, is_odd); }));
+    }
+    {
+        List list;
+        fill_scattered(list);
+        print_row("remove odd, remove_if", time_ms([&] { list.remove_if(is_odd); }));
+    }
+    {
+        std::forward_list<int> list;
+        fill_scattered(list);
+        print_row("remove odd, std::forward_list", time_ms([&] { list.remove_if(is_odd); }));
+    }
+
+    // All but 1000 nodes are freed
+    {
+        List list;
+        fill_scattered(list);
+        print_row("unique, ForwardList", time_ms([&] { list.unique(); }));
+    }
+    {
+        std::forward_list<int> list;
+        fill_scattered(list);
+        print_row("unique, std::forward_list", time_ms([&] { list.unique(); }));
+    }
+}
+
+const size_t COMPACT_SIZE = 4000000;
+
+void bench_compact()
+{
+    using stlcontainer::bench::print_row;
+
+    stlcontainer::ForwardList<int> list;
+    fill_shuffled(list, COMPACT_SIZE);
+    print_row("traverse, allocation order", traverse_ms(list));
+    std::printf("  locality_score %.1f\n", list.locality_score());
+
+    list.sort();
+    print_row("traverse, scattered (after sort)", traverse_ms(list));
+    std::printf("  locality_score %.1f\n", list.locality_score());
+
+    print_row("compact", stlcontainer::bench::time_ms([&] { list.compact(); }));
+    print_row("traverse, after compact", traverse_ms(list));
+    std::printf("  locality_score %.1f\n", list.locality_score());
+}
+
+const size_t CONCURRENT_OPERATIONS = 2000000;
+const size_t MAX_THREADS = 32;
+
+// Shared work list: every thread alternates push_front and pop_front, CONCURRENT_OPERATIONS in total
+template<typename PushPop>
+double push_pop_ms(size_t threads, PushPop&& push_pop)
+{
+    auto per_thread = CONCURRENT_OPERATIONS / threads / 2;
+    return stlcontainer::bench::run_threads_ms(threads, [&](size_t thread) {
+        for (size_t index = 0; index < per_thread; ++index)
+        {
+            push_pop(static_cast<int>(thread * per_thread + index));
+        }
+    });
+}
+
+void bench_concurrent()
+{
+    char name[64];
+    for (size_t threads = 1; threads <= MAX_THREADS; threads *= 2)
+    {
+        {
+            stlcontainer::ForwardList<int> list(1000, 0);
+            std::mutex mutex;
+            auto ms = push_pop_ms(threads, [&](int value) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    list.push_front(value);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                list.pop_front();
+            });
+            std::snprintf(name, sizeof(name), "ForwardList + mutex, %zu threads", threads);
+            stlcontainer::bench::print_throughput_row(name, ms, CONCURRENT_OPERATIONS);
+        }
+        {
+            stlcontainer::ConcurrentForwardList<int> list;
+            for (int index = 0; index < 1000; ++index)
+            {
+                list.push_front(0);
+            }
+            auto ms = push_pop_ms(threads, [&](int value) {
+                list.push_front(value);
+                list.try_pop_front(value);
+            });
+            std::snprintf(name, sizeof(name), "ConcurrentForwardList, %zu threads", threads);
+            stlcontainer::bench::print_throughput_row(name, ms, CONCURRENT_OPERATIONS);
+        }
+    }
+}
+
+bool selected(int argc, char* argv[], const char* name)
+{
+    if (argc < 2)
+    {
+        return true;
+    }
+    for (int index = 1; index < argc; ++index)
+    {
+        if (std::strcmp(argv[index], name) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// Runs every section, or only those named on the command line
+int main(int argc, char* argv[])
+{
+    if (selected(argc, argv, "alloc"))
+    {
+        stlcontainer::bench::print_header("ForwardList node allocation: build / traverse / destroy, 1M ints");
+        bench_build_traverse_destroy<std::forward_list<int>>("std::forward_list<int>");
+        bench_build_traverse_destroy<stlcontainer::ForwardList<int>>("stlcontainer::ForwardList<int>");
+    }
+    if (selected(argc, argv, "sort"))
+    {
+        stlcontainer::bench::print_header("ForwardList sort, 10M shuffled ints");
+        bench_sort();
+    }
+    if (selected(argc, argv, "unrolled"))
+    {
+        stlcontainer::bench::print_header("UnrolledForwardList traversal, sum of 1M ints");
+        bench_unrolled_traverse();
+        stlcontainer::bench::print_header("UnrolledForwardList insert / erase");
+        bench_unrolled_edit();
+    }
+    if (selected(argc, argv, "prefetch"))
+    {
+        stlcontainer::bench::print_header("ForwardList bulk traversal, 24M scattered ints");
+        bench_prefetch();
+    }
+    if (selected(argc, argv, "compact"))
+    {
+        stlcontainer::bench::print_header("ForwardList compact, sum of 4M ints");
+        bench_compact();
+    }
+    if (selected(argc, argv, "concurrent"))
+    {
+        stlcontainer::bench::print_throughput_header("Shared work list, push_front + pop_front pairs, 2M operations");
+        bench_concurrent();
+    }
+    return 0;
+}
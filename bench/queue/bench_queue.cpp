@@ -0,0 +1,995 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <map>
+#include <numeric>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Benchmark.h"
+#include "queue/BlockingQueue.h"
+#include "queue/DelayQueue.h"
+#include "queue/IndexedPriorityQueue.h"
+#include "queue/MPMCQueue.h"
+#include "queue/PriorityQueue.h"
+#include "queue/Queue.h"
+#include "queue/RingBuffer.h"
+#include "queue/SPSCQueue.h"
+#include "queue/ThreadPool.h"
+#include "queue/WorkStealingDeque.h"
+
+namespace
+{
+
+const size_t MESSAGES = 10000000;
+const size_t ROUND_TRIPS = 200000;
+const size_t RING_CAPACITY = 1024;
+const size_t PRODUCER_CORE = 0;
+const size_t CONSUMER_CORE = 1;
+const size_t MPMC_MESSAGES = 4000000;
+const size_t MPMC_MAX_PAIRS = 32;
+const size_t MPMC_BATCH = 32;
+const size_t BATCH_ELEMENTS = 16000000;
+const size_t BATCH_SIZES[] = {1, 16, 256};
+const size_t FIFO_OPERATIONS = 50000000;
+const size_t FIFO_BACKLOGS[] = {16, 4096, 1000000};
+const size_t HEAP_OPERATIONS = 10000000;
+const size_t HEAP_HELD = 1000000;
+const size_t HEAP_HELD_SIZES[] = {HEAP_HELD, HEAP_OPERATIONS};
+const size_t TIMERS = 1000000;
+const uint32_t TIMER_SPAN_MS = 60000;
+const size_t DEQUE_OPERATIONS = 20000000;
+const size_t SUM_ELEMENTS = 32000000;
+const size_t SUM_GRAIN = 16384;
+const size_t SORT_ELEMENTS = 8000000;
+const size_t SORT_GRAIN = 4096;
+const size_t WAKE_SAMPLES = 500;
+const auto WAKE_PAUSE = std::chrono::microseconds(500);
+
+// With fewer than two CPUs a spinning thread only hands over at the end of its time slice, so waiting
+// threads yield instead. Numbers from such a machine measure the scheduler, not the queue.
+bool shared_core()
+{
+    return std::thread::hardware_concurrency() < 2;
+}
+
+inline void wait_turn(bool yield)
+{
+    if (yield)
+    {
+        std::this_thread::yield();
+    }
+}
+
+// Baseline: stlcontainer::Queue over std::deque behind a mutex, bounded like the ring
+template<typename T>
+class MutexQueue
+{
+public:
+    explicit MutexQueue(size_t capacity) : _capacity(capacity) {}
+
+    bool try_push(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.size() == _capacity)
+        {
+            return false;
+        }
+        _queue.push(value);
+        return true;
+    }
+
+    bool try_pop(T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty())
+        {
+            return false;
+        }
+        value = _queue.front();
+        _queue.pop();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    stlcontainer::Queue<T> _queue;
+    size_t _capacity;
+};
+
+// MESSAGES integers from a producer on PRODUCER_CORE to a consumer on CONSUMER_CORE
+template<typename QueueType>
+double transfer_ms(QueueType& queue)
+{
+    auto yield = shared_core();
+    return stlcontainer::bench::run_threads_ms(2, [&](size_t thread) {
+        if (thread == 0)
+        {
+            stlcontainer::bench::pin_to_core(PRODUCER_CORE);
+            for (size_t index = 0; index < MESSAGES; ++index)
+            {
+                while (!queue.try_push(index))
+                {
+                    wait_turn(yield);
+                }
+            }
+        }
+        else
+        {
+            stlcontainer::bench::pin_to_core(CONSUMER_CORE);
+            size_t value = 0;
+            size_t sum = 0;
+            for (size_t index = 0; index < MESSAGES; ++index)
+            {
+                while (!queue.try_pop(value))
+                {
+                    wait_turn(yield);
+                }
+                sum += value;
+            }
+            stlcontainer::bench::do_not_optimize(sum);
+        }
+    });
+}
+
+// Round trips of one message through a pair of queues: the producer sends, an echo thread on the other core
+// sends it back. Samples are round-trip times in ns.
+template<typename QueueType>
+std::vector<double> round_trip_ns()
+{
+    using clock = std::chrono::steady_clock;
+    QueueType ping(RING_CAPACITY);
+    QueueType pong(RING_CAPACITY);
+    std::vector<double> samples;
+    samples.reserve(ROUND_TRIPS);
+    auto yield = shared_core();
+
+    stlcontainer::bench::run_threads_ms(2, [&](size_t thread) {
+        size_t value = 0;
+        if (thread == 0)
+        {
+            stlcontainer::bench::pin_to_core(PRODUCER_CORE);
+            for (size_t index = 0; index < ROUND_TRIPS; ++index)
+            {
+                auto start = clock::now();
+                while (!ping.try_push(index))
+                {
+                    wait_turn(yield);
+                }
+                while (!pong.try_pop(value))
+                {
+                    wait_turn(yield);
+                }
+                samples.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count());
+            }
+        }
+        else
+        {
+            stlcontainer::bench::pin_to_core(CONSUMER_CORE);
+            for (size_t index = 0; index < ROUND_TRIPS; ++index)
+            {
+                while (!ping.try_pop(value))
+                {
+                    wait_turn(yield);
+                }
+                while (!pong.try_push(value))
+                {
+                    wait_turn(yield);
+                }
+            }
+        }
+    });
+    return samples;
+}
+
+void bench_spsc()
+{
+    if (shared_core())
+    {
+        std::printf("\nFewer than two CPUs: threads share one core and yield while waiting\n");
+    }
+
+    stlcontainer::bench::print_throughput_header("Queue SPSC transfer, 10M messages, producer and consumer on separate cores");
+    {
+        stlcontainer::SPSCQueue<size_t> queue(RING_CAPACITY);
+        stlcontainer::bench::print_throughput_row("SPSCQueue", transfer_ms(queue), MESSAGES);
+    }
+    {
+        MutexQueue<size_t> queue(RING_CAPACITY);
+        stlcontainer::bench::print_throughput_row("Queue<std::deque> + std::mutex", transfer_ms(queue), MESSAGES);
+    }
+
+    stlcontainer::bench::print_latency_header("Queue SPSC round trip, 200K messages");
+    {
+        auto samples = round_trip_ns<stlcontainer::SPSCQueue<size_t>>();
+        stlcontainer::bench::print_latency_row("SPSCQueue", samples);
+    }
+    {
+        auto samples = round_trip_ns<MutexQueue<size_t>>();
+        stlcontainer::bench::print_latency_row("Queue<std::deque> + std::mutex", samples);
+    }
+}
+
+// Baseline for the blocking forms: the same mutex-guarded Queue with condition variables for full and empty
+template<typename T>
+class CondvarQueue
+{
+public:
+    explicit CondvarQueue(size_t capacity) : _capacity(capacity) {}
+
+    void push(const T& value)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_full.wait(lock, [this] { return _queue.size() < _capacity; });
+        _queue.push(value);
+        lock.unlock();
+        _not_empty.notify_one();
+    }
+
+    void pop(T& value)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_empty.wait(lock, [this] { return !_queue.empty(); });
+        value = _queue.front();
+        _queue.pop();
+        lock.unlock();
+        _not_full.notify_one();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    stlcontainer::Queue<T> _queue;
+    size_t _capacity;
+};
+
+// MPMC_MESSAGES integers split evenly over pairs producers and pairs consumers using blocking push and pop
+template<typename QueueType>
+double blocking_transfer_ms(size_t pairs)
+{
+    QueueType queue(RING_CAPACITY);
+    auto perThread = MPMC_MESSAGES / pairs;
+    return stlcontainer::bench::run_threads_ms(2 * pairs, [&](size_t thread) {
+        size_t value = 0;
+        size_t sum = 0;
+        for (size_t index = 0; index < perThread; ++index)
+        {
+            if (thread < pairs)
+            {
+                queue.push(index);
+            }
+            else
+            {
+                queue.pop(value);
+                sum += value;
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// As above with push_n / pop_n moving up to MPMC_BATCH elements per claim
+double bulk_transfer_ms(size_t pairs)
+{
+    stlcontainer::MPMCQueue<size_t> queue(RING_CAPACITY);
+    auto perThread = MPMC_MESSAGES / pairs;
+    return stlcontainer::bench::run_threads_ms(2 * pairs, [&](size_t thread) {
+        size_t batch[MPMC_BATCH];
+        size_t sum = 0;
+        for (size_t done = 0; done < perThread;)
+        {
+            auto count = std::min(MPMC_BATCH, perThread - done);
+            if (thread < pairs)
+            {
+                for (size_t index = 0; index < count; ++index)
+                {
+                    batch[index] = done + index;
+                }
+                queue.push_n(batch, count);
+            }
+            else
+            {
+                count = queue.pop_n(batch, count);
+                for (size_t index = 0; index < count; ++index)
+                {
+                    sum += batch[index];
+                }
+            }
+            done += count;
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+void bench_mpmc()
+{
+    if (shared_core())
+    {
+        std::printf("\nFewer than two CPUs: all threads share one core, scaling rows measure the scheduler\n");
+    }
+
+    for (size_t pairs = 1; pairs <= MPMC_MAX_PAIRS; pairs *= 2)
+    {
+        auto title = "Queue MPMC transfer, 4M messages, " + std::to_string(pairs) + " producers + "
+            + std::to_string(pairs) + " consumers";
+        stlcontainer::bench::print_throughput_header(title.c_str());
+        stlcontainer::bench::print_throughput_row("MPMCQueue push/pop",
+            blocking_transfer_ms<stlcontainer::MPMCQueue<size_t>>(pairs), MPMC_MESSAGES);
+        stlcontainer::bench::print_throughput_row("MPMCQueue push_n/pop_n, batch 32",
+            bulk_transfer_ms(pairs), MPMC_MESSAGES);
+        stlcontainer::bench::print_throughput_row("Queue<std::deque> + mutex + condvar",
+            blocking_transfer_ms<CondvarQueue<size_t>>(pairs), MPMC_MESSAGES);
+    }
+}
+
+// BATCH_ELEMENTS through a Queue in rounds of batch: push a batch, then drain it
+template<typename QueueType>
+double element_wise_ms(size_t batch)
+{
+    QueueType queue;
+    return stlcontainer::bench::best_of_ms(3, [&] {
+        size_t sum = 0;
+        for (size_t done = 0; done < BATCH_ELEMENTS; done += batch)
+        {
+            for (size_t index = 0; index < batch; ++index)
+            {
+                queue.push(done + index);
+            }
+            for (size_t index = 0; index < batch; ++index)
+            {
+                sum += queue.front();
+                queue.pop();
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+template<typename QueueType>
+double batched_ms(size_t batch)
+{
+    QueueType queue;
+    std::vector<size_t> input(batch);
+    std::vector<size_t> output(batch);
+    return stlcontainer::bench::best_of_ms(3, [&] {
+        size_t sum = 0;
+        for (size_t done = 0; done < BATCH_ELEMENTS; done += batch)
+        {
+            for (size_t index = 0; index < batch; ++index)
+            {
+                input[index] = done + index;
+            }
+            queue.push_range(input.begin(), input.end());
+            auto count = queue.pop_into(output.begin(), batch);
+            for (size_t index = 0; index < count; ++index)
+            {
+                sum += output[index];
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+void bench_batch()
+{
+    for (auto batch : BATCH_SIZES)
+    {
+        auto title = "Queue batched push_range / pop_into, 16M elements, batch " + std::to_string(batch);
+        stlcontainer::bench::print_cost_header(title.c_str());
+        stlcontainer::bench::print_cost_row("Queue<std::deque> push + front/pop",
+            element_wise_ms<stlcontainer::Queue<size_t>>(batch), BATCH_ELEMENTS);
+        stlcontainer::bench::print_cost_row("Queue<std::deque> push_range + pop_into",
+            batched_ms<stlcontainer::Queue<size_t>>(batch), BATCH_ELEMENTS);
+        stlcontainer::bench::print_cost_row("Queue<std::list> push + front/pop",
+            element_wise_ms<stlcontainer::Queue<size_t, std::list<size_t>>>(batch), BATCH_ELEMENTS);
+        stlcontainer::bench::print_cost_row("Queue<std::list> push_range + pop_into",
+            batched_ms<stlcontainer::Queue<size_t, std::list<size_t>>>(batch), BATCH_ELEMENTS);
+    }
+}
+
+// Steady FIFO traffic: the queue holds backlog elements while FIFO_OPERATIONS pushes each pair with a pop
+template<typename QueueType>
+double steady_fifo_ms(size_t backlog)
+{
+    QueueType queue;
+    for (size_t index = 0; index < backlog; ++index)
+    {
+        queue.push(index);
+    }
+    return stlcontainer::bench::best_of_ms(3, [&] {
+        size_t sum = 0;
+        for (size_t index = 0; index < FIFO_OPERATIONS; ++index)
+        {
+            queue.push(index);
+            sum += queue.front();
+            queue.pop();
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+void bench_ring()
+{
+    for (auto backlog : FIFO_BACKLOGS)
+    {
+        auto title = "Queue steady FIFO, 50M push+pop, backlog " + std::to_string(backlog);
+        stlcontainer::bench::print_cost_header(title.c_str());
+        stlcontainer::bench::print_cost_row("Queue<std::deque>",
+            steady_fifo_ms<stlcontainer::Queue<size_t>>(backlog), FIFO_OPERATIONS);
+        stlcontainer::bench::print_cost_row("Queue<RingBuffer>",
+            steady_fifo_ms<stlcontainer::Queue<size_t, stlcontainer::RingBuffer<size_t>>>(backlog),
+            FIFO_OPERATIONS);
+    }
+}
+
+std::vector<uint32_t> random_keys(size_t count)
+{
+    std::mt19937 random(1);
+    std::vector<uint32_t> keys(count);
+    for (auto& key : keys)
+    {
+        key = static_cast<uint32_t>(random());
+    }
+    return keys;
+}
+
+// Hold model: a heap of held keys, then HEAP_OPERATIONS rounds of pop followed by push
+template<typename HeapType>
+double hold_ms(const std::vector<uint32_t>& keys, size_t held)
+{
+    HeapType heap(keys.begin(), keys.begin() + held);
+    return stlcontainer::bench::time_ms([&] {
+        uint64_t sum = 0;
+        for (size_t index = 0; index < HEAP_OPERATIONS; ++index)
+        {
+            sum += heap.top();
+            heap.pop();
+            heap.push(keys[index]);
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// HEAP_OPERATIONS keys heapified at once, then the top read
+template<typename HeapType>
+double construct_ms(const std::vector<uint32_t>& keys)
+{
+    return stlcontainer::bench::best_of_ms(3, [&] {
+        HeapType heap(keys.begin(), keys.begin() + HEAP_OPERATIONS);
+        stlcontainer::bench::do_not_optimize(heap.top());
+    });
+}
+
+// Min-heap of HEAP_HELD keys, HEAP_OPERATIONS times lowering a random element's key. Indexed: promote in
+// place. std::priority_queue has no such call, so it pushes a new entry and leaves the stale one behind,
+// and the run ends by draining, skipping stale entries, the way lazy-deletion Dijkstra does.
+double decrease_key_indexed_ms(const std::vector<uint32_t>& keys)
+{
+    stlcontainer::IndexedPriorityQueue<uint32_t, std::greater<uint32_t>> heap(keys.begin(), keys.begin() + HEAP_HELD);
+    std::vector<uint32_t> current(keys.begin(), keys.begin() + HEAP_HELD);
+    return stlcontainer::bench::time_ms([&] {
+        for (size_t index = 0; index < HEAP_OPERATIONS; ++index)
+        {
+            auto handle = keys[index] % HEAP_HELD;
+            current[handle] -= std::min(current[handle], keys[index] >> 24);
+            heap.promote(handle, current[handle]);
+        }
+        uint64_t sum = 0;
+        while (!heap.empty())
+        {
+            sum += heap.top();
+            heap.pop();
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+double decrease_key_lazy_ms(const std::vector<uint32_t>& keys)
+{
+    using entry = std::pair<uint32_t, uint32_t>;
+    std::vector<entry> entries;
+    for (size_t index = 0; index < HEAP_HELD; ++index)
+    {
+        entries.push_back(entry(keys[index], static_cast<uint32_t>(index)));
+    }
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> heap(entries.begin(), entries.end());
+    std::vector<uint32_t> current(keys.begin(), keys.begin() + HEAP_HELD);
+    return stlcontainer::bench::time_ms([&] {
+        for (size_t index = 0; index < HEAP_OPERATIONS; ++index)
+        {
+            auto handle = keys[index] % HEAP_HELD;
+            current[handle] -= std::min(current[handle], keys[index] >> 24);
+            heap.push(entry(current[handle], static_cast<uint32_t>(handle)));
+        }
+        uint64_t sum = 0;
+        while (!heap.empty())
+        {
+            auto top = heap.top();
+            heap.pop();
+            if (top.first == current[top.second])
+            {
+                sum += top.first;
+                current[top.second] = UINT32_MAX;
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+void bench_priority()
+{
+    auto keys = random_keys(HEAP_OPERATIONS);
+
+    for (auto held : HEAP_HELD_SIZES)
+    {
+        auto title = "PriorityQueue hold model, " + std::to_string(held / 1000000) + "M held, 10M pop+push";
+        stlcontainer::bench::print_throughput_header(title.c_str());
+        stlcontainer::bench::print_throughput_row("std::priority_queue",
+            hold_ms<std::priority_queue<uint32_t>>(keys, held), HEAP_OPERATIONS);
+        stlcontainer::bench::print_throughput_row("PriorityQueue, 2-ary",
+            hold_ms<stlcontainer::PriorityQueue<uint32_t, std::less<uint32_t>, stlcontainer::Vector<uint32_t>, 2>>(keys, held),
+            HEAP_OPERATIONS);
+        stlcontainer::bench::print_throughput_row("PriorityQueue, 4-ary",
+            hold_ms<stlcontainer::PriorityQueue<uint32_t>>(keys, held), HEAP_OPERATIONS);
+        stlcontainer::bench::print_throughput_row("PriorityQueue, 8-ary",
+            hold_ms<stlcontainer::PriorityQueue<uint32_t, std::less<uint32_t>, stlcontainer::Vector<uint32_t>, 8>>(keys, held),
+            HEAP_OPERATIONS);
+    }
+
+    stlcontainer::bench::print_throughput_header("PriorityQueue bulk construction, 10M keys");
+    stlcontainer::bench::print_throughput_row("std::priority_queue(first, last)",
+        construct_ms<std::priority_queue<uint32_t>>(keys), HEAP_OPERATIONS);
+    stlcontainer::bench::print_throughput_row("PriorityQueue(first, last), 4-ary",
+        construct_ms<stlcontainer::PriorityQueue<uint32_t>>(keys), HEAP_OPERATIONS);
+
+    stlcontainer::bench::print_throughput_header("PriorityQueue decrease-key, 1M held, 10M key changes, then drain");
+    stlcontainer::bench::print_throughput_row("std::priority_queue, lazy deletion", decrease_key_lazy_ms(keys),
+        HEAP_OPERATIONS);
+    stlcontainer::bench::print_throughput_row("IndexedPriorityQueue::decrease_key", decrease_key_indexed_ms(keys),
+        HEAP_OPERATIONS);
+}
+
+// Baseline timer sets behind the DelayQueue interface, deadlines in whole ms since zero.
+// std::multimap: the sorted side structure, with iterators as handles.
+class MapTimers
+{
+public:
+    using handle_type = std::multimap<uint64_t, uint32_t>::iterator;
+
+    handle_type schedule(uint64_t deadline, uint32_t value)
+    {
+        return _timers.emplace(deadline, value);
+    }
+
+    void cancel(handle_type handle)
+    {
+        _timers.erase(handle);
+    }
+
+    template<typename Function>
+    void advance(uint64_t now, Function&& on_expired)
+    {
+        while (!_timers.empty() && _timers.begin()->first <= now)
+        {
+            on_expired(_timers.begin()->second);
+            _timers.erase(_timers.begin());
+        }
+    }
+
+private:
+    std::multimap<uint64_t, uint32_t> _timers;
+};
+
+// Min-heap on (deadline, value) with erase by handle
+class HeapTimers
+{
+public:
+    using handle_type = size_t;
+
+    handle_type schedule(uint64_t deadline, uint32_t value)
+    {
+        return _timers.push(std::make_pair(deadline, value));
+    }
+
+    void cancel(handle_type handle)
+    {
+        _timers.erase(handle);
+    }
+
+    template<typename Function>
+    void advance(uint64_t now, Function&& on_expired)
+    {
+        while (!_timers.empty() && _timers.top().first <= now)
+        {
+            on_expired(_timers.top().second);
+            _timers.pop();
+        }
+    }
+
+private:
+    stlcontainer::IndexedPriorityQueue<std::pair<uint64_t, uint32_t>, std::greater<std::pair<uint64_t, uint32_t>>> _timers;
+};
+
+// The wheel in ms ticks, driven with explicit time points so the run does not read the clock
+class WheelTimers
+{
+public:
+    using wheel_type = stlcontainer::DelayQueue<uint32_t>;
+    using handle_type = wheel_type::handle_type;
+
+    WheelTimers() : _start(wheel_type::clock_type::now()), _wheel(std::chrono::milliseconds(1), _start) {}
+
+    handle_type schedule(uint64_t deadline, uint32_t value)
+    {
+        return _wheel.schedule(_start + std::chrono::milliseconds(deadline), value);
+    }
+
+    void cancel(handle_type handle)
+    {
+        _wheel.cancel(handle);
+    }
+
+    template<typename Function>
+    void advance(uint64_t now, Function&& on_expired)
+    {
+        _wheel.advance(_start + std::chrono::milliseconds(now), on_expired);
+    }
+
+private:
+    wheel_type::time_point _start;
+    wheel_type _wheel;
+};
+
+// TIMERS timers with deadlines spread over TIMER_SPAN_MS: schedule them all, re-arm each once (cancel and
+// schedule later, as an idle timeout does on activity), then advance 1 ms at a time until all have fired
+template<typename Timers>
+void timer_rows(const char* name, const std::vector<uint32_t>& keys)
+{
+    Timers timers;
+    std::vector<typename Timers::handle_type> handles;
+    handles.reserve(TIMERS);
+    char label[64];
+
+    auto schedule = stlcontainer::bench::time_ms([&] {
+        for (size_t index = 0; index < TIMERS; ++index)
+        {
+            handles.push_back(timers.schedule(keys[index] % TIMER_SPAN_MS + 1, static_cast<uint32_t>(index)));
+        }
+    });
+    std::snprintf(label, sizeof(label), "%s schedule", name);
+    stlcontainer::bench::print_throughput_row(label, schedule, TIMERS);
+
+    auto rearm = stlcontainer::bench::time_ms([&] {
+        for (size_t index = 0; index < TIMERS; ++index)
+        {
+            timers.cancel(handles[index]);
+            handles[index] = timers.schedule(keys[index] % TIMER_SPAN_MS + 1000, static_cast<uint32_t>(index));
+        }
+    });
+    std::snprintf(label, sizeof(label), "%s cancel + schedule", name);
+    stlcontainer::bench::print_throughput_row(label, rearm, TIMERS);
+
+    size_t fired = 0;
+    auto drain = stlcontainer::bench::time_ms([&] {
+        for (uint64_t now = 1; now <= TIMER_SPAN_MS + 1000; ++now)
+        {
+            timers.advance(now, [&fired](uint32_t) { ++fired; });
+        }
+    });
+    std::snprintf(label, sizeof(label), "%s advance 1ms x 61K", name);
+    stlcontainer::bench::print_throughput_row(label, drain, static_cast<double>(fired));
+}
+
+void bench_timer()
+{
+    auto keys = random_keys(TIMERS);
+    stlcontainer::bench::print_throughput_header("DelayQueue, 1M pending timers over 60s");
+    timer_rows<MapTimers>("std::multimap", keys);
+    timer_rows<HeapTimers>("IndexedPriorityQueue", keys);
+    timer_rows<WheelTimers>("DelayQueue", keys);
+}
+
+// Owner-only use, the common case for a worker that finds its own work: push a burst of 16, pop it back
+template<typename Deque>
+double owner_cycle_ms()
+{
+    Deque deque;
+    return stlcontainer::bench::best_of_ms(3, [&deque] {
+        size_t sum = 0;
+        size_t value = 0;
+        for (size_t round = 0; round < DEQUE_OPERATIONS / 16; ++round)
+        {
+            for (size_t index = 0; index < 16; ++index)
+            {
+                deque.push(round + index);
+            }
+            while (deque.try_pop(value))
+            {
+                sum += value;
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// Baseline: what a pool without work-stealing deques uses per worker
+class LockedDeque
+{
+public:
+    void push(size_t value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _values.push_back(value);
+    }
+
+    bool try_pop(size_t& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_values.empty())
+        {
+            return false;
+        }
+        value = _values.back();
+        _values.pop_back();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<size_t> _values;
+};
+
+uint64_t fork_join_sum(stlcontainer::ThreadPool& pool, const uint32_t* first, const uint32_t* last)
+{
+    if (static_cast<size_t>(last - first) <= SUM_GRAIN)
+    {
+        return std::accumulate(first, last, uint64_t(0));
+    }
+    auto middle = first + (last - first) / 2;
+    uint64_t left = 0;
+    stlcontainer::TaskGroup group;
+    pool.spawn(group, [&pool, &left, first, middle] { left = fork_join_sum(pool, first, middle); });
+    auto right = fork_join_sum(pool, middle, last);
+    pool.wait(group);
+    return left + right;
+}
+
+void fork_join_sort(stlcontainer::ThreadPool& pool, uint32_t* first, uint32_t* last)
+{
+    if (static_cast<size_t>(last - first) <= SORT_GRAIN)
+    {
+        std::sort(first, last);
+        return;
+    }
+    auto pivot = first[(last - first) / 2];
+    auto middle = std::partition(first, last, [pivot](uint32_t value) { return value < pivot; });
+    auto upper = std::partition(middle, last, [pivot](uint32_t value) { return !(pivot < value); });
+    stlcontainer::TaskGroup group;
+    pool.spawn(group, [&pool, first, middle] { fork_join_sort(pool, first, middle); });
+    fork_join_sort(pool, upper, last);
+    pool.wait(group);
+}
+
+// 1, 2, 4, ... workers up to the CPU count, which always comes last
+std::vector<size_t> worker_counts()
+{
+    size_t cpus = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<size_t> counts;
+    for (size_t count = 1; count < cpus; count *= 2)
+    {
+        counts.push_back(count);
+    }
+    counts.push_back(cpus);
+    return counts;
+}
+
+void bench_steal()
+{
+    stlcontainer::bench::print_throughput_header("Work-stealing deque, owner push/pop in bursts of 16, 20M operations");
+    stlcontainer::bench::print_throughput_row("std::deque + mutex", owner_cycle_ms<LockedDeque>(), DEQUE_OPERATIONS * 2);
+    stlcontainer::bench::print_throughput_row("WorkStealingDeque",
+        owner_cycle_ms<stlcontainer::WorkStealingDeque<size_t>>(), DEQUE_OPERATIONS * 2);
+
+    if (shared_core())
+    {
+        std::printf("\nFewer than two CPUs: only the 1-worker rows run, they show the cost of spawning\n");
+    }
+
+    auto keys = random_keys(std::max(SUM_ELEMENTS, SORT_ELEMENTS));
+    char label[64];
+
+    stlcontainer::bench::print_cost_header("ThreadPool fork-join sum, 32M uint32, split down to 16K");
+    auto serial = stlcontainer::bench::best_of_ms(3, [&keys] {
+        stlcontainer::bench::do_not_optimize(std::accumulate(keys.begin(), keys.begin() + SUM_ELEMENTS, uint64_t(0)));
+    });
+    stlcontainer::bench::print_cost_row("std::accumulate, serial", serial, SUM_ELEMENTS);
+    for (auto workers : worker_counts())
+    {
+        stlcontainer::ThreadPool pool(workers);
+        auto ms = stlcontainer::bench::best_of_ms(3, [&pool, &keys] {
+            stlcontainer::bench::do_not_optimize(fork_join_sum(pool, keys.data(), keys.data() + SUM_ELEMENTS));
+        });
+        std::snprintf(label, sizeof(label), "ThreadPool, %zu workers", workers);
+        stlcontainer::bench::print_cost_row(label, ms, SUM_ELEMENTS);
+    }
+
+    stlcontainer::bench::print_cost_header("ThreadPool fork-join quicksort, 8M uint32, split down to 4K");
+    std::vector<uint32_t> values;
+    serial = 0;
+    for (size_t run = 0; run < 3; ++run)
+    {
+        values.assign(keys.begin(), keys.begin() + SORT_ELEMENTS);
+        auto ms = stlcontainer::bench::time_ms([&values] { std::sort(values.begin(), values.end()); });
+        serial = run == 0 || ms < serial ? ms : serial;
+    }
+    stlcontainer::bench::print_cost_row("std::sort, serial", serial, SORT_ELEMENTS);
+    for (auto workers : worker_counts())
+    {
+        stlcontainer::ThreadPool pool(workers);
+        double best = 0;
+        for (size_t run = 0; run < 3; ++run)
+        {
+            values.assign(keys.begin(), keys.begin() + SORT_ELEMENTS);
+            auto ms = stlcontainer::bench::time_ms([&pool, &values] {
+                fork_join_sort(pool, values.data(), values.data() + values.size());
+            });
+            best = run == 0 || ms < best ? ms : best;
+        }
+        std::snprintf(label, sizeof(label), "ThreadPool, %zu workers", workers);
+        stlcontainer::bench::print_cost_row(label, best, SORT_ELEMENTS);
+    }
+}
+
+int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The producer sends a timestamp WAKE_PAUSE after the consumer took the previous one, long enough for an
+// idle consumer to go to sleep; the consumer records how long each timestamp took to reach it
+template<typename Push, typename Pop>
+std::vector<double> wake_latency_ns(Push&& push, Pop&& pop)
+{
+    std::vector<double> samples;
+    samples.reserve(WAKE_SAMPLES);
+    std::atomic<size_t> received(0);
+    std::thread consumer([&] {
+        for (size_t index = 0; index < WAKE_SAMPLES; ++index)
+        {
+            auto sent = pop();
+            samples.push_back(static_cast<double>(now_ns() - sent));
+            received.store(index + 1, std::memory_order_release);
+        }
+    });
+    for (size_t index = 0; index < WAKE_SAMPLES; ++index)
+    {
+        std::this_thread::sleep_for(WAKE_PAUSE);
+        push(now_ns());
+        while (received.load(std::memory_order_acquire) != index + 1)
+        {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+    return samples;
+}
+
+// What consumers did before BlockingQueue: check a locked Queue, sleep, check again
+std::vector<double> polling_latency_ns(std::chrono::microseconds interval)
+{
+    std::mutex mutex;
+    stlcontainer::Queue<int64_t> queue;
+    return wake_latency_ns(
+        [&](int64_t value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push(value);
+        },
+        [&] {
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!queue.empty())
+                    {
+                        auto value = queue.front();
+                        queue.pop();
+                        return value;
+                    }
+                }
+                std::this_thread::sleep_for(interval);
+            }
+        });
+}
+
+void bench_wake()
+{
+    stlcontainer::bench::print_latency_header("Wake-up latency of an idle consumer, push to pop returning");
+
+    auto samples = polling_latency_ns(std::chrono::milliseconds(1));
+    stlcontainer::bench::print_latency_row("poll Queue::empty, sleep 1ms", samples);
+    samples = polling_latency_ns(std::chrono::microseconds(100));
+    stlcontainer::bench::print_latency_row("poll Queue::empty, sleep 100us", samples);
+
+    stlcontainer::BlockingQueue<int64_t> blocking;
+    samples = wake_latency_ns([&](int64_t value) { blocking.push(value); },
+        [&] {
+            int64_t value = 0;
+            blocking.pop(value);
+            return value;
+        });
+    stlcontainer::bench::print_latency_row("BlockingQueue::pop", samples);
+
+    stlcontainer::MPMCQueue<int64_t> lockFree(RING_CAPACITY);
+    samples = wake_latency_ns([&](int64_t value) { lockFree.push(value); },
+        [&] {
+            int64_t value = 0;
+            lockFree.pop(value);
+            return value;
+        });
+    stlcontainer::bench::print_latency_row("MPMCQueue::pop, spin then futex", samples);
+}
+
+bool selected(int argc, char* argv[], const char* name)
+{
+    if (argc < 2)
+    {
+        return true;
+    }
+    for (int index = 1; index < argc; ++index)
+    {
+        if (std::strcmp(argv[index], name) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// Runs every section, or only those named on the command line
+int main(int argc, char* argv[])
+{
+    if (selected(argc, argv, "spsc"))
+    {
+        bench_spsc();
+    }
+    if (selected(argc, argv, "mpmc"))
+    {
+        bench_mpmc();
+    }
+    if (selected(argc, argv, "batch"))
+    {
+        bench_batch();
+    }
+    if (selected(argc, argv, "ring"))
+    {
+        bench_ring();
+    }
+    if (selected(argc, argv, "priority"))
+    {
+        bench_priority();
+    }
+    if (selected(argc, argv, "timer"))
+    {
+        bench_timer();
+    }
+    if (selected(argc, argv, "steal"))
+    {
+        bench_steal();
+    }
+    if (selected(argc, argv, "wake"))
+    {
+        bench_wake();
+    }
+    return 0;
+}
@@ -0,0 +1,566 @@
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "../Benchmark.h"
+#include "stack/ConcurrentStack.h"
+#include "stack/PersistentStack.h"
+#include "stack/SegmentedStack.h"
+#include "stack/Stack.h"
+#include "stack/StaticStack.h"
+#include "vector/Vector.h"
+
+namespace
+{
+
+const size_t WALK_OPERATIONS = 50000000;
+const size_t WALK_MAX_DEPTHS[] = {64, 100000};
+const size_t SAWTOOTH_DEPTH = 32;
+const size_t FILL_ELEMENTS = 20000000;
+const size_t BATCH_ELEMENTS = 20000000;
+const size_t BATCH_SIZE = 64;
+const size_t DFS_NODES = 10000000;
+const size_t DFS_INLINE_DEPTH = 256;
+const size_t FREELIST_OPERATIONS = 4000000;
+const size_t FREELIST_BUFFERS = 1024;
+const size_t FREELIST_THREADS[] = {1, 2, 4, 8, 16, 32, 64};
+const size_t SPECULATION_ROUNDS = 100000;
+const size_t SPECULATION_MAX_FRAMES[] = {16, 512};
+const size_t SPECULATION_BASE_DEPTH = 64;
+const size_t SPECULATION_MAX_DEPTH = 100000;
+const unsigned SPECULATION_ROLLBACK_PERCENT = 70;
+const size_t RUNS = 3;
+
+// Baseline: the shared freelist as it is today, stlcontainer::Stack behind a mutex, bounded like the pool
+template<typename T>
+class MutexStack
+{
+public:
+    explicit MutexStack(size_t capacity) : _capacity(capacity) {}
+
+    bool try_push(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stack.size() == _capacity)
+        {
+            return false;
+        }
+        _stack.push(value);
+        return true;
+    }
+
+    bool try_pop(T& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stack.empty())
+        {
+            return false;
+        }
+        value = _stack.top();
+        _stack.pop();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    stlcontainer::Stack<T> _stack;
+    size_t _capacity;
+};
+
+// A freelist of FREELIST_BUFFERS buffer ids shared by threads threads, each taking a buffer and giving it
+// back, FREELIST_OPERATIONS take/give pairs in total
+template<typename FreeList>
+double freelist_ms(size_t threads)
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [threads] {
+        FreeList freelist(FREELIST_BUFFERS);
+        for (size_t buffer = 0; buffer < FREELIST_BUFFERS; ++buffer)
+        {
+            freelist.try_push(static_cast<uint32_t>(buffer));
+        }
+        stlcontainer::bench::run_threads_ms(threads, [&freelist, threads](size_t) {
+            uint32_t buffer = 0;
+            for (size_t round = 0; round < FREELIST_OPERATIONS / threads; ++round)
+            {
+                if (freelist.try_pop(buffer))
+                {
+                    freelist.try_push(buffer);
+                }
+            }
+        });
+    });
+}
+
+// A graph in compressed sparse row form: the neighbours of node are targets[first[node]] up to
+// targets[first[node + 1]]
+struct Graph
+{
+    std::vector<uint32_t> first;
+    std::vector<uint32_t> targets;
+};
+
+// A random tree of DFS_NODES nodes numbered breadth first, each inner node with 1 to 4 children. Its depth
+// is logarithmic, so the DFS stack stays within a bound known up front, as it does for a parse tree or a
+// bounded-depth search.
+Graph random_tree()
+{
+    std::mt19937 gen(42);
+    Graph graph;
+    graph.first.reserve(DFS_NODES + 1);
+    graph.targets.reserve(DFS_NODES);
+    uint32_t next = 1;
+    for (size_t node = 0; node < DFS_NODES; ++node)
+    {
+        graph.first.push_back(static_cast<uint32_t>(graph.targets.size()));
+        auto children = std::min<size_t>(1 + gen() % 4, DFS_NODES - next);
+        for (size_t child = 0; child < children; ++child)
+        {
+            graph.targets.push_back(next++);
+        }
+    }
+    graph.first.push_back(static_cast<uint32_t>(graph.targets.size()));
+    return graph;
+}
+
+// Iterative depth-first walk from node 0, summing node ids so the walk cannot be optimized away
+template<typename Stack>
+double dfs_ms(const Graph& graph)
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [&graph] {
+        Stack stack;
+        uint64_t sum = 0;
+        stack.push(0);
+        while (!stack.empty())
+        {
+            auto node = stack.top();
+            stack.pop();
+            sum += node;
+            for (auto edge = graph.first[node]; edge != graph.first[node + 1]; ++edge)
+            {
+                stack.push(graph.targets[edge]);
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// Deepest the DFS stack gets, to show the bound the inline capacity is chosen against
+size_t dfs_max_depth(const Graph& graph)
+{
+    std::vector<uint32_t> stack(1, 0);
+    size_t max_depth = 1;
+    while (!stack.empty())
+    {
+        auto node = stack.back();
+        stack.pop_back();
+        for (auto edge = graph.first[node]; edge != graph.first[node + 1]; ++edge)
+        {
+            stack.push_back(graph.targets[edge]);
+        }
+        max_depth = std::max(max_depth, stack.size());
+    }
+    return max_depth;
+}
+
+// A parser's stack: pushes and pops in random order, depth wandering between 0 and max_depth. The moves
+// are drawn up front so the loop measures the stack, not the random number generator.
+std::vector<bool> random_walk(size_t max_depth)
+{
+    std::mt19937 gen(42);
+    std::vector<bool> pushes;
+    pushes.reserve(WALK_OPERATIONS);
+    size_t depth = 0;
+    for (size_t index = 0; index < WALK_OPERATIONS; ++index)
+    {
+        auto push = depth == 0 || (depth < max_depth && (gen() & 1) != 0);
+        depth += push ? 1 : -1;
+        pushes.push_back(push);
+    }
+    return pushes;
+}
+
+template<typename Stack>
+double walk_ms(const std::vector<bool>& pushes)
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [&pushes] {
+        Stack stack;
+        int sum = 0;
+        for (size_t index = 0; index < pushes.size(); ++index)
+        {
+            if (pushes[index])
+            {
+                stack.push(static_cast<int>(index));
+            }
+            else
+            {
+                sum += stack.top();
+                stack.pop();
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// Nested scopes as a parser meets them: open 1, 2, ... SAWTOOTH_DEPTH levels and close them again. The
+// pattern is regular, so branch prediction takes the random walk's mispredictions out of the picture.
+template<typename Stack>
+double sawtooth_ms()
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [] {
+        Stack stack;
+        int sum = 0;
+        size_t operations = 0;
+        while (operations < WALK_OPERATIONS)
+        {
+            for (size_t depth = 1; depth <= SAWTOOTH_DEPTH; ++depth)
+            {
+                for (size_t level = 0; level < depth; ++level)
+                {
+                    stack.push(static_cast<int>(level));
+                }
+                for (size_t level = 0; level < depth; ++level)
+                {
+                    sum += stack.top();
+                    stack.pop();
+                }
+                operations += 2 * depth;
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// Push FILL_ELEMENTS one by one, then pop them all. With reserved set the stack reserves room first.
+template<typename Stack>
+double fill_drain_ms(bool reserved = false)
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [reserved] {
+        Stack stack;
+        if (reserved)
+        {
+            stack.reserve(FILL_ELEMENTS);
+        }
+        for (size_t index = 0; index < FILL_ELEMENTS; ++index)
+        {
+            stack.push(static_cast<int>(index));
+        }
+        int sum = 0;
+        while (!stack.empty())
+        {
+            sum += stack.top();
+            stack.pop();
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// Moves BATCH_ELEMENTS through the stack BATCH_SIZE at a time with push_range and pop_n, on top of a
+// base of BATCH_SIZE elements that stays put
+template<typename Stack>
+double batch_ms()
+{
+    std::vector<int> batch(BATCH_SIZE, 1);
+    std::vector<int> popped(BATCH_SIZE);
+    return stlcontainer::bench::best_of_ms(RUNS, [&] {
+        Stack stack;
+        stack.push_range(batch.begin(), batch.end());
+        int sum = 0;
+        for (size_t round = 0; round < BATCH_ELEMENTS / BATCH_SIZE; ++round)
+        {
+            stack.push_range(batch.begin(), batch.end());
+            stack.pop_n(popped.begin(), BATCH_SIZE);
+            sum += popped[0];
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// An interpreter frame: trivially destructible, as the frames of a bytecode interpreter usually are
+struct Frame
+{
+    uint64_t pc;
+    uint64_t locals[3];
+};
+
+// One speculative step: push frames, then roll back or commit them
+struct Speculation
+{
+    uint32_t frames;
+    bool rollback;
+};
+
+std::vector<Speculation> speculations(size_t max_frames)
+{
+    std::mt19937 gen(42);
+    std::vector<Speculation> steps;
+    steps.reserve(SPECULATION_ROUNDS);
+    for (size_t round = 0; round < SPECULATION_ROUNDS; ++round)
+    {
+        steps.push_back({static_cast<uint32_t>(1 + gen() % max_frames), gen() % 100 < SPECULATION_ROLLBACK_PERCENT});
+    }
+    return steps;
+}
+
+// How each stack saves a position, pushes and returns to a saved position. Stack has no marks, so it
+// records its size and pops back down one element at a time, as the interpreter does today.
+size_t save(const stlcontainer::Stack<Frame>& stack)
+{
+    return stack.size();
+}
+
+void restore(stlcontainer::Stack<Frame>& stack, size_t saved)
+{
+    while (stack.size() > saved)
+    {
+        stack.pop();
+    }
+}
+
+void keep(stlcontainer::Stack<Frame>&, size_t)
+{
+}
+
+void push_frame(stlcontainer::Stack<Frame>& stack, const Frame& frame)
+{
+    stack.push(frame);
+}
+
+stlcontainer::SegmentedStack<Frame>::mark_type save(const stlcontainer::SegmentedStack<Frame>& stack)
+{
+    return stack.mark();
+}
+
+void restore(stlcontainer::SegmentedStack<Frame>& stack, const stlcontainer::SegmentedStack<Frame>::mark_type& mark)
+{
+    stack.rollback(mark);
+}
+
+void keep(stlcontainer::SegmentedStack<Frame>& stack, const stlcontainer::SegmentedStack<Frame>::mark_type& mark)
+{
+    stack.commit(mark);
+}
+
+void push_frame(stlcontainer::SegmentedStack<Frame>& stack, const Frame& frame)
+{
+    stack.push(frame);
+}
+
+// The snapshot is the saved stack itself
+stlcontainer::PersistentStack<Frame> save(const stlcontainer::PersistentStack<Frame>& stack)
+{
+    return stack;
+}
+
+void restore(stlcontainer::PersistentStack<Frame>& stack, const stlcontainer::PersistentStack<Frame>& snapshot)
+{
+    stack = snapshot;
+}
+
+void keep(stlcontainer::PersistentStack<Frame>&, const stlcontainer::PersistentStack<Frame>&)
+{
+}
+
+void push_frame(stlcontainer::PersistentStack<Frame>& stack, const Frame& frame)
+{
+    stack = stack.push(frame);
+}
+
+// Runs the speculative steps over a base of SPECULATION_BASE_DEPTH frames. Committed frames pile up until
+// the stack passes SPECULATION_MAX_DEPTH, then it returns to the base as a finished call tree would.
+template<typename Stack>
+double speculate_ms(const std::vector<Speculation>& steps)
+{
+    return stlcontainer::bench::best_of_ms(RUNS, [&steps] {
+        Stack stack;
+        for (size_t depth = 0; depth < SPECULATION_BASE_DEPTH; ++depth)
+        {
+            push_frame(stack, Frame{depth, {0, 0, 0}});
+        }
+        auto base = save(stack);
+        uint64_t sum = 0;
+        for (const auto& step : steps)
+        {
+            auto saved = save(stack);
+            for (uint32_t frame = 0; frame < step.frames; ++frame)
+            {
+                push_frame(stack, Frame{frame, {step.frames, 0, 0}});
+            }
+            sum += stack.top().pc;
+            if (step.rollback)
+            {
+                restore(stack, saved);
+            }
+            else
+            {
+                keep(stack, saved);
+                if (stack.size() > SPECULATION_MAX_DEPTH)
+                {
+                    restore(stack, base);
+                }
+            }
+        }
+        stlcontainer::bench::do_not_optimize(sum);
+    });
+}
+
+// Frames pushed by the steps, for the throughput column
+size_t speculated_frames(const std::vector<Speculation>& steps)
+{
+    size_t frames = 0;
+    for (const auto& step : steps)
+    {
+        frames += step.frames;
+    }
+    return frames;
+}
+
+void bench_walk()
+{
+    for (auto max_depth : WALK_MAX_DEPTHS)
+    {
+        auto pushes = random_walk(max_depth);
+        auto title = "Stack random push/pop walk, 50M operations, depth 0.." + std::to_string(max_depth);
+        stlcontainer::bench::print_throughput_header(title.c_str());
+        stlcontainer::bench::print_throughput_row("std::stack (std::deque)", walk_ms<std::stack<int>>(pushes),
+            WALK_OPERATIONS);
+        stlcontainer::bench::print_throughput_row("Stack<std::deque>",
+            walk_ms<stlcontainer::Stack<int, std::deque<int>>>(pushes), WALK_OPERATIONS);
+        stlcontainer::bench::print_throughput_row("Stack<std::vector>",
+            walk_ms<stlcontainer::Stack<int, std::vector<int>>>(pushes), WALK_OPERATIONS);
+        stlcontainer::bench::print_throughput_row("Stack<Vector> (default)", walk_ms<stlcontainer::Stack<int>>(pushes),
+            WALK_OPERATIONS);
+    }
+
+    stlcontainer::bench::print_throughput_header("Stack nested scopes 1..32 deep, 50M operations");
+    stlcontainer::bench::print_throughput_row("std::stack (std::deque)", sawtooth_ms<std::stack<int>>(), WALK_OPERATIONS);
+    stlcontainer::bench::print_throughput_row("Stack<std::deque>", sawtooth_ms<stlcontainer::Stack<int, std::deque<int>>>(),
+        WALK_OPERATIONS);
+    stlcontainer::bench::print_throughput_row("Stack<std::vector>",
+        sawtooth_ms<stlcontainer::Stack<int, std::vector<int>>>(), WALK_OPERATIONS);
+    stlcontainer::bench::print_throughput_row("Stack<Vector> (default)", sawtooth_ms<stlcontainer::Stack<int>>(),
+        WALK_OPERATIONS);
+}
+
+void bench_fill()
+{
+    stlcontainer::bench::print_throughput_header("Stack fill then drain, 20M ints");
+    stlcontainer::bench::print_throughput_row("Stack<std::deque>", fill_drain_ms<stlcontainer::Stack<int, std::deque<int>>>(),
+        FILL_ELEMENTS * 2);
+    stlcontainer::bench::print_throughput_row("Stack<std::vector>",
+        fill_drain_ms<stlcontainer::Stack<int, std::vector<int>>>(), FILL_ELEMENTS * 2);
+    stlcontainer::bench::print_throughput_row("Stack<Vector> (default)", fill_drain_ms<stlcontainer::Stack<int>>(),
+        FILL_ELEMENTS * 2);
+    stlcontainer::bench::print_throughput_row("Stack<Vector>, reserve(20M) first",
+        fill_drain_ms<stlcontainer::Stack<int>>(true), FILL_ELEMENTS * 2);
+}
+
+void bench_batch()
+{
+    stlcontainer::bench::print_throughput_header("Stack push_range + pop_n, batches of 64, 20M ints");
+    stlcontainer::bench::print_throughput_row("Stack<std::deque>", batch_ms<stlcontainer::Stack<int, std::deque<int>>>(),
+        BATCH_ELEMENTS * 2);
+    stlcontainer::bench::print_throughput_row("Stack<Vector> (default)", batch_ms<stlcontainer::Stack<int>>(),
+        BATCH_ELEMENTS * 2);
+}
+
+void bench_dfs()
+{
+    using ThrowingStack = stlcontainer::StaticStack<uint32_t, DFS_INLINE_DEPTH>;
+    using SpillingStack = stlcontainer::StaticStack<uint32_t, 16, stlcontainer::StaticStackSpillToHeap<uint32_t>>;
+
+    auto graph = random_tree();
+    std::printf("\nDFS stack depth peaks at %zu\n", dfs_max_depth(graph));
+    stlcontainer::bench::print_throughput_header("Stack iterative DFS over a 10M-node tree");
+    stlcontainer::bench::print_throughput_row("std::stack (std::deque)", dfs_ms<std::stack<uint32_t>>(graph), DFS_NODES);
+    stlcontainer::bench::print_throughput_row("Stack<Vector> (default)", dfs_ms<stlcontainer::Stack<uint32_t>>(graph),
+        DFS_NODES);
+    stlcontainer::bench::print_throughput_row("StaticStack<256>", dfs_ms<ThrowingStack>(graph), DFS_NODES);
+    stlcontainer::bench::print_throughput_row("StaticStack<16>, spills to heap", dfs_ms<SpillingStack>(graph),
+        DFS_NODES);
+}
+
+void bench_freelist()
+{
+    for (auto threads : FREELIST_THREADS)
+    {
+        auto title = "Stack shared freelist, 4M take/give pairs, " + std::to_string(threads) + " threads";
+        stlcontainer::bench::print_throughput_header(title.c_str());
+        stlcontainer::bench::print_throughput_row("mutex + Stack<Vector>", freelist_ms<MutexStack<uint32_t>>(threads),
+            FREELIST_OPERATIONS * 2);
+        stlcontainer::bench::print_throughput_row("ConcurrentStack, no elimination",
+            freelist_ms<stlcontainer::ConcurrentStack<uint32_t, 0>>(threads), FREELIST_OPERATIONS * 2);
+        stlcontainer::bench::print_throughput_row("ConcurrentStack, 8 exchangers",
+            freelist_ms<stlcontainer::ConcurrentStack<uint32_t>>(threads), FREELIST_OPERATIONS * 2);
+    }
+}
+
+void bench_speculate()
+{
+    for (auto max_frames : SPECULATION_MAX_FRAMES)
+    {
+        auto steps = speculations(max_frames);
+        auto frames = speculated_frames(steps);
+        auto title = "Stack speculative frames, 100K steps of 1.." + std::to_string(max_frames) +
+            " frames, 70% rolled back";
+        stlcontainer::bench::print_throughput_header(title.c_str());
+        stlcontainer::bench::print_throughput_row("Stack<Vector>, pop back one by one",
+            speculate_ms<stlcontainer::Stack<Frame>>(steps), frames);
+        stlcontainer::bench::print_throughput_row("SegmentedStack, mark/rollback",
+            speculate_ms<stlcontainer::SegmentedStack<Frame>>(steps), frames);
+        stlcontainer::bench::print_throughput_row("PersistentStack, snapshots",
+            speculate_ms<stlcontainer::PersistentStack<Frame>>(steps), frames);
+    }
+}
+
+bool selected(int argc, char* argv[], const char* name)
+{
+    if (argc < 2)
+    {
+        return true;
+    }
+    for (int index = 1; index < argc; ++index)
+    {
+        if (std::strcmp(argv[index], name) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// Runs every section, or only those named on the command line
+int main(int argc, char* argv[])
+{
+    if (selected(argc, argv, "walk"))
+    {
+        bench_walk();
+    }
+    if (selected(argc, argv, "fill"))
+    {
+        bench_fill();
+    }
+    if (selected(argc, argv, "batch"))
+    {
+        bench_batch();
+    }
+    if (selected(argc, argv, "dfs"))
+    {
+        bench_dfs();
+    }
+    if (selected(argc, argv, "freelist"))
+    {
+        bench_freelist();
+    }
+    if (selected(argc, argv, "speculate"))
+    {
+        bench_speculate();
+    }
+    return 0;
+}
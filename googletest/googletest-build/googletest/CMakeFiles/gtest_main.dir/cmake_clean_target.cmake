@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "/tmp/tsan_build/lib/libgtest_main.a"
+)
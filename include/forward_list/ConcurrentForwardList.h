@@ -0,0 +1,404 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "EpochReclamation.h"
+
+namespace stlcontainer
+{
+
+// Lock-free singly linked list (Harris): push_front, insert_after, erase_after and try_pop_front may be
+// called from any number of threads at once.
+//
+// Erasing first marks the low bit of the victim's next link (logical delete), which freezes that link, then
+// unlinks it with a CAS on its predecessor. Any operation that runs into a marked node helps unlink it, and
+// whichever thread unlinks a node retires it to the EpochDomain, which frees it once no pinned thread can
+// still see it.
+//
+// Iterators and positions are only valid while the calling thread holds an EpochGuard. A position may be
+// erased by another thread at any time: its node stays readable under the guard, iteration skips erased
+// nodes, and insert_after/erase_after on an erased position fail instead of touching the list.
+// Elements are immutable once inserted. The destructor, assignment and clear() are not thread-safe.
+template<typename ListDataType>
+class ConcurrentForwardList
+{
+// Type definitions
+private:
+    struct node_base
+    {
+        std::atomic<uintptr_t> _next;
+
+        explicit node_base(uintptr_t next = 0) noexcept : _next(next) {}
+    };
+
+    struct node : node_base
+    {
+        ListDataType _value;
+
+        template<typename... Args>
+        explicit node(Args&&... args) : node_base(), _value(std::forward<Args>(args)...) {}
+    };
+
+    static const uintptr_t MARK = 1;
+
+public:
+    using value_type = ListDataType;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using guard_type = stlcontainer::EpochGuard;
+
+    static_assert(alignof(node) > MARK, "The low bit of node addresses must be free for the mark");
+
+    // Forward iterator over unerased elements as of the moment each step is taken
+    class iterator : public std::iterator<std::forward_iterator_tag, const ListDataType, std::ptrdiff_t,
+        const ListDataType*, const ListDataType&>
+    {
+    friend class ConcurrentForwardList<ListDataType>;
+
+    public:
+        const ListDataType& operator* () const
+        {
+            return static_cast<node*>(_pointee)->_value;
+        }
+
+        iterator& operator++()
+        {
+            _pointee = next_unmarked(_pointee);
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator returnval(_pointee);
+            ++(*this);
+            return returnval;
+        }
+
+        bool operator==(iterator other) const
+        {
+            return _pointee == other._pointee;
+        }
+
+        bool operator!=(iterator other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        node_base* _pointee;     // nullptr is end()
+        explicit iterator(node_base* pointee) : _pointee(pointee) {};
+    };
+
+    using const_iterator = iterator;
+
+public:
+    // Member Functions: Constructors
+    ConcurrentForwardList() noexcept : _before_head() {};
+
+    ConcurrentForwardList(std::initializer_list<ListDataType> initList) : ConcurrentForwardList()
+    {
+        node_base* tail = &_before_head;
+        for (const auto& elem : initList)
+        {
+            auto new_node = new node(elem);
+            tail->_next.store(to_link(new_node), std::memory_order_relaxed);
+            tail = new_node;
+        }
+    }
+
+    ConcurrentForwardList(const ConcurrentForwardList& other) = delete;
+    ConcurrentForwardList& operator=(const ConcurrentForwardList& other) = delete;
+
+    // Member Functions: Destructor
+    // No other thread may use the list any more. Nodes already retired are freed by the domain.
+    ~ConcurrentForwardList()
+    {
+        clear();
+    }
+
+    // Member Functions: Iterators, require an EpochGuard
+    iterator before_begin() noexcept
+    {
+        return iterator(&_before_head);
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(next_unmarked(&_before_head));
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(nullptr);
+    }
+
+    // Member Functions: Capacity
+    // A snapshot, other threads may change it right after
+    bool empty() noexcept
+    {
+        guard_type guard;
+        return next_unmarked(&_before_head) == nullptr;
+    }
+
+    // Walks the list, a snapshot like empty()
+    size_t size() noexcept
+    {
+        guard_type guard;
+        size_t count = 0;
+        for (auto iter = begin(); iter != end(); ++iter)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Member Functions: Modifiers
+    void push_front(const ListDataType& value)
+    {
+        emplace_front(value);
+    }
+
+    void push_front(ListDataType&& value)
+    {
+        emplace_front(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_front(Args&&... args)
+    {
+        auto new_node = new node(std::forward<Args>(args)...);
+        auto head = _before_head._next.load(std::memory_order_relaxed);
+        do
+        {
+            new_node->_next.store(head, std::memory_order_relaxed);
+        } while (!_before_head._next.compare_exchange_weak(head, to_link(new_node),
+            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Returns iterator to the new element, or end() if pos was erased meanwhile. Requires an EpochGuard.
+    iterator insert_after(iterator pos, const ListDataType& value)
+    {
+        return emplace_after(pos, value);
+    }
+
+    iterator insert_after(iterator pos, ListDataType&& value)
+    {
+        return emplace_after(pos, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace_after(iterator pos, Args&&... args)
+    {
+        auto node_before = pos._pointee;
+        auto new_node = new node(std::forward<Args>(args)...);
+        auto next = node_before->_next.load(std::memory_order_acquire);
+        while (true)
+        {
+            if (is_marked(next))
+            {
+                delete new_node;
+                return end();
+            }
+            new_node->_next.store(next, std::memory_order_relaxed);
+            if (node_before->_next.compare_exchange_weak(next, to_link(new_node),
+                std::memory_order_release, std::memory_order_acquire))
+            {
+                return iterator(new_node);
+            }
+        }
+    }
+
+    // Erases the element currently following pos. Returns false if there is none or pos was erased
+    // meanwhile. Requires an EpochGuard.
+    bool erase_after(iterator pos)
+    {
+        return erase_next(pos._pointee, nullptr);
+    }
+
+    // Erases the first element and copies it to value, false if the list was empty
+    bool try_pop_front(ListDataType& value)
+    {
+        guard_type guard;
+        return erase_next(&_before_head, &value);
+    }
+
+    // Not thread-safe
+    void clear() noexcept
+    {
+        auto link = _before_head._next.load(std::memory_order_relaxed);
+        _before_head._next.store(0, std::memory_order_relaxed);
+        while (auto curr_node = to_node(link))
+        {
+            link = curr_node->_next.load(std::memory_order_relaxed);
+            delete static_cast<node*>(curr_node);
+        }
+    }
+
+private:
+    node_base _before_head;
+
+    static bool is_marked(uintptr_t link) noexcept
+    {
+        return link & MARK;
+    }
+
+    static node_base* to_node(uintptr_t link) noexcept
+    {
+        return reinterpret_cast<node_base*>(link & ~MARK);
+    }
+
+    static uintptr_t to_link(node_base* node_ptr) noexcept
+    {
+        return reinterpret_cast<uintptr_t>(node_ptr);
+    }
+
+    static void delete_node(void* node_ptr)
+    {
+        delete static_cast<node*>(static_cast<node_base*>(node_ptr));
+    }
+
+    // First unerased node after node_ptr, read-only
+    static node_base* next_unmarked(node_base* node_ptr) noexcept
+    {
+        auto curr_node = to_node(node_ptr->_next.load(std::memory_order_acquire));
+        while (curr_node && is_marked(curr_node->_next.load(std::memory_order_acquire)))
+        {
+            curr_node = to_node(curr_node->_next.load(std::memory_order_acquire));
+        }
+        return curr_node;
+    }
+
+    // Unlinks victim, whose next link is already marked, from node_before. Only the thread whose CAS
+    // succeeds retires it.
+    static bool unlink(node_base* node_before, node_base* victim, uintptr_t victim_next)
+    {
+        auto expected = to_link(victim);
+        if (node_before->_next.compare_exchange_strong(expected, victim_next & ~MARK,
+            std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            stlcontainer::EpochDomain::instance().retire(victim, &delete_node);
+            return true;
+        }
+        return false;
+    }
+
+    bool erase_next(node_base* node_before, ListDataType* value)
+    {
+        guard_type guard;
+        while (true)
+        {
+            auto link = node_before->_next.load(std::memory_order_acquire);
+            if (is_marked(link) || !link)
+            {
+                return false;
+            }
+
+            auto victim = to_node(link);
+            auto victim_next = victim->_next.load(std::memory_order_acquire);
+            if (is_marked(victim_next))
+            {
+                // Someone else's erase, help finish it and look at the new successor
+                unlink(node_before, victim, victim_next);
+                continue;
+            }
+
+            if (victim->_next.compare_exchange_weak(victim_next, victim_next | MARK,
+                std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                if (value)
+                {
+                    *value = static_cast<node*>(victim)->_value;
+                }
+                if (!unlink(node_before, victim, victim_next))
+                {
+                    finish_unlink(node_before, victim, victim_next);
+                }
+                return true;
+            }
+        }
+    }
+
+    // Called when unlinking victim from node_before failed: either a helper already unlinked it, or new
+    // nodes went in between. Walks forward until victim (unlinks it) or its frozen successor (gone already).
+    void finish_unlink(node_base* node_before, node_base* victim, uintptr_t victim_next)
+    {
+        auto victim_successor = to_node(victim_next);
+        while (true)
+        {
+            auto link = node_before->_next.load(std::memory_order_acquire);
+            if (is_marked(link))
+            {
+                // node_before was erased meanwhile, start over from the head
+                unlink_marked();
+                return;
+            }
+
+            auto curr_node = to_node(link);
+            if (!curr_node || curr_node == victim_successor)
+            {
+                return;
+            }
+            if (curr_node == victim)
+            {
+                if (unlink(node_before, victim, victim_next))
+                {
+                    return;
+                }
+                continue;
+            }
+
+            auto next = curr_node->_next.load(std::memory_order_acquire);
+            if (is_marked(next))
+            {
+                unlink(node_before, curr_node, next);
+                continue;
+            }
+            node_before = curr_node;
+        }
+    }
+
+    // Unlinks every marked node reachable from the head
+    void unlink_marked()
+    {
+        while (!try_unlink_marked())
+        {
+        }
+    }
+
+    // One pass, false if a link changed underneath and the pass has to start over
+    bool try_unlink_marked()
+    {
+        node_base* node_before = &_before_head;
+        auto link = node_before->_next.load(std::memory_order_acquire);
+        while (link)
+        {
+            if (is_marked(link))
+            {
+                return false;
+            }
+            auto curr_node = to_node(link);
+            auto next = curr_node->_next.load(std::memory_order_acquire);
+            if (is_marked(next))
+            {
+                if (!unlink(node_before, curr_node, next))
+                {
+                    return false;
+                }
+                link = next & ~MARK;
+                continue;
+            }
+            node_before = curr_node;
+            link = next;
+        }
+        return true;
+    }
+};
+
+template<typename ListDataType>
+const uintptr_t ConcurrentForwardList<ListDataType>::MARK;
+
+} // namespace stlcontainer
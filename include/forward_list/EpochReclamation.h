@@ -0,0 +1,257 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace stlcontainer
+{
+
+// Epoch-based memory reclamation for lock-free containers.
+//
+// A thread pins the domain (EpochGuard) for as long as it may dereference shared nodes. A node unlinked
+// from a container is retired instead of deleted; it is deleted once the global epoch has advanced three
+// times past the epoch it was retired in, which guarantees every thread that could still hold a pointer
+// to it has unpinned since. The global epoch only advances when every pinned thread has observed the
+// current one, so a thread stalled inside a guard delays reclamation but never makes it unsafe.
+//
+// There is one process-wide domain shared by every container: retired nodes carry their own deleter.
+// Each thread owns a record, reused by later threads after it exits, along with anything it had not
+// yet freed.
+class EpochDomain
+{
+public:
+    using deleter_type = void (*)(void*);
+
+    // Retires between attempts to advance the global epoch
+    static const size_t ADVANCE_INTERVAL = 64;
+
+public:
+    EpochDomain(const EpochDomain& other) = delete;
+    EpochDomain& operator=(const EpochDomain& other) = delete;
+
+    static EpochDomain& instance()
+    {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    // Nested pins are allowed and cheap
+    void pin()
+    {
+        auto record = thread_record();
+        if (record->_nesting++ == 0)
+        {
+            // Publishing the pin must be ordered before any load of a shared node. The exchange is a full
+            // barrier in hardware (and visible to ThreadSanitizer, which ignores fences), the fence makes the
+            // store-load ordering formal against the fence in try_advance.
+            auto epoch = _epoch.load(std::memory_order_acquire);
+            record->_state.exchange((epoch << 1) | ACTIVE, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            free_expired(record, epoch);
+        }
+    }
+
+    void unpin() noexcept
+    {
+        auto record = thread_record();
+        if (--record->_nesting == 0)
+        {
+            record->_state.store(0, std::memory_order_release);
+        }
+    }
+
+    // node must already be unreachable for threads that pin from now on. Call while pinned.
+    void retire(void* node, deleter_type deleter)
+    {
+        // Tagged with the global epoch rather than the pinned one: a pin may lag the global epoch, and
+        // readers that saw the node before it was unlinked can be pinned as late as the current epoch
+        auto record = thread_record();
+        auto epoch = _epoch.load(std::memory_order_acquire);
+        auto& bag = record->_bags[epoch % BAG_COUNT];
+        if (bag._epoch != epoch)
+        {
+            // Whatever is left in this bag was retired at least BAG_COUNT epochs ago
+            bag.free();
+            bag._epoch = epoch;
+        }
+        bag._nodes.push_back(retired_node{node, deleter});
+
+        if (++record->_retired_since_advance >= ADVANCE_INTERVAL)
+        {
+            record->_retired_since_advance = 0;
+            try_advance();
+        }
+    }
+
+    uint64_t epoch() const noexcept
+    {
+        return _epoch.load(std::memory_order_acquire);
+    }
+
+    // Advances the global epoch if every pinned thread has observed it, returns whether it moved
+    bool try_advance() noexcept
+    {
+        auto epoch = _epoch.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (auto record = _records.load(std::memory_order_acquire); record; record = record->_next)
+        {
+            auto state = record->_state.load(std::memory_order_seq_cst);
+            if ((state & ACTIVE) && (state >> 1) != epoch)
+            {
+                return false;
+            }
+        }
+        return _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+    }
+
+    // Frees what the calling thread retired as far as it is safe to, for tests and shutdown paths.
+    // Must not be called while pinned.
+    void collect() noexcept
+    {
+        auto record = thread_record();
+        for (size_t index = 0; index < BAG_COUNT + 1; ++index)
+        {
+            try_advance();
+        }
+        free_expired(record, _epoch.load(std::memory_order_acquire));
+    }
+
+private:
+    static const uint64_t ACTIVE = 1;
+    static const size_t BAG_COUNT = 3;
+
+    struct retired_node
+    {
+        void* _node;
+        deleter_type _deleter;
+    };
+
+    struct retired_bag
+    {
+        uint64_t _epoch = 0;
+        std::vector<retired_node> _nodes;
+
+        void free() noexcept
+        {
+            for (auto& retired : _nodes)
+            {
+                retired._deleter(retired._node);
+            }
+            _nodes.clear();
+        }
+    };
+
+    struct thread_record_type
+    {
+        std::atomic<uint64_t> _state{0};        // (epoch << 1) | ACTIVE while pinned, 0 otherwise
+        std::atomic<bool> _in_use{true};
+        thread_record_type* _next = nullptr;
+
+        // Owner thread only
+        size_t _nesting = 0;
+        size_t _retired_since_advance = 0;
+        retired_bag _bags[BAG_COUNT];
+    };
+
+    // Releases the thread's record when the thread exits
+    struct thread_handle
+    {
+        thread_record_type* _record = nullptr;
+
+        ~thread_handle()
+        {
+            if (_record)
+            {
+                _record->_in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    std::atomic<uint64_t> _epoch{BAG_COUNT};
+    std::atomic<thread_record_type*> _records{nullptr};
+
+    EpochDomain() = default;
+
+    // Runs at process exit, after every thread_local handle is gone
+    ~EpochDomain()
+    {
+        auto record = _records.load(std::memory_order_acquire);
+        while (record)
+        {
+            auto next_record = record->_next;
+            for (auto& bag : record->_bags)
+            {
+                bag.free();
+            }
+            delete record;
+            record = next_record;
+        }
+    }
+
+    thread_record_type* thread_record()
+    {
+        static thread_local thread_handle handle;
+        if (!handle._record)
+        {
+            handle._record = acquire_record();
+        }
+        return handle._record;
+    }
+
+    thread_record_type* acquire_record()
+    {
+        for (auto record = _records.load(std::memory_order_acquire); record; record = record->_next)
+        {
+            bool in_use = false;
+            if (!record->_in_use.load(std::memory_order_relaxed)
+                && record->_in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+            {
+                return record;
+            }
+        }
+
+        auto record = new thread_record_type();
+        auto head = _records.load(std::memory_order_relaxed);
+        do
+        {
+            record->_next = head;
+        } while (!_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        return record;
+    }
+
+    static void free_expired(thread_record_type* record, uint64_t epoch) noexcept
+    {
+        for (auto& bag : record->_bags)
+        {
+            if (!bag._nodes.empty() && bag._epoch + BAG_COUNT <= epoch)
+            {
+                bag.free();
+            }
+        }
+    }
+};
+
+// Pins the domain for the guard's lifetime
+class EpochGuard
+{
+public:
+    explicit EpochGuard(EpochDomain& domain = EpochDomain::instance()) : _domain(domain)
+    {
+        _domain.pin();
+    }
+
+    EpochGuard(const EpochGuard& other) = delete;
+    EpochGuard& operator=(const EpochGuard& other) = delete;
+
+    ~EpochGuard()
+    {
+        _domain.unpin();
+    }
+
+private:
+    EpochDomain& _domain;
+};
+
+} // namespace stlcontainer
@@ -1,17 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 #include "ForwardListIterator.h"
+#include "ForwardListNodePool.h"
+#include "ForwardListSizePolicy.h"
 
 namespace stlcontainer
 {
 
-template<typename ListDataType>
-class ForwardList
+template<typename ListDataType, typename SizePolicy = stlcontainer::ForwardListUntrackedSize>
+class ForwardList : private SizePolicy
 {
 // Type definitions
 private:
     using forward_list_node = typename stlcontainer::ForwardListNode<ListDataType>;
     using node_pointer = typename stlcontainer::ForwardListNode<ListDataType>*;
+    using node_base = typename stlcontainer::ForwardListNodeBase<ListDataType>;
+    using node_base_pointer = typename stlcontainer::ForwardListNodeBase<ListDataType>*;
+    using node_pool = typename stlcontainer::ForwardListNodePool<forward_list_node>;
+    using node_pool_pointer = std::shared_ptr<node_pool>;
 
 public:
     using value_type = ListDataType;
@@ -19,180 +31,177 @@ public:
     using const_reference = const reference;
     using iterator = typename stlcontainer::ForwardListIterator<ListDataType>;
     using const_iterator = const iterator;
+    using pool_type = node_pool;
+    using size_policy = SizePolicy;
 
 public:
     // Member Functions: Constructors
-    // Default constructor
-    explicit ForwardList() : _head(make_node(value_type{}, nullptr)), _tail(_head) {};
+    // Default constructor, allocates nothing until the first insert
+    explicit ForwardList() noexcept : _pool(), _before_head(nullptr) {};
+
+    // Shared pool constructor, lists on one pool splice and merge without joining pools
+    explicit ForwardList(node_pool_pointer pool) noexcept : _pool(std::move(pool)), _before_head(nullptr) {};
 
     // Fill constructor
-    ForwardList(size_t count, ListDataType value) : _head(make_node(value, nullptr)), _tail(_head)
+    ForwardList(size_t count, const ListDataType& value) : ForwardList()
     {
-        auto prev_node = _head;
-        size_t index = 0;
-        while (++index < count)   // pre-increment of index means can use count, not (count - 1)
-        {
-            auto new_node = make_node(value, nullptr);
-            prev_node->_next = new_node;
-            prev_node = new_node;
-        }
-        _tail = make_node(value_type{}, nullptr);   // One past last node
-        prev_node->_next = _tail;
+        insert_after(before_begin(), count, value);
     }
 
     // TODO range constructor
 
     // Copy constructor
-    ForwardList(const ForwardList& other) : _head(make_node(other._head->_value, nullptr)), _tail(_head)
+    ForwardList(const ForwardList& other) : ForwardList()
     {
-        auto next_node = other._head->_next;
-        auto prev_node = _head;
-        while (next_node != other._tail)
-        {
-            auto new_node = make_node(next_node->_value, nullptr);
-            prev_node->_next = new_node;  
-            prev_node = new_node;
-            next_node = next_node->_next;
-        }
-        _tail = make_node(value_type{}, nullptr);   // One past last node
-        prev_node->_next = _tail;
-    } 
+        append_copy(&_before_head, other._before_head._next, nullptr);
+    }
 
     // Move constructor
-    ForwardList(ForwardList&& other) : _head(std::move(other._head)), _tail(std::move(other._tail))
+    ForwardList(ForwardList&& other) noexcept : _pool(std::move(other._pool)), _before_head(other._before_head._next)
     {
-        other._head = nullptr;
-        other._tail = nullptr;
+        this->set_size(other.tracked_size());
+        other._before_head._next = nullptr;
+        other.set_size(0);
     }
 
     // Initializer list constructor
-    ForwardList(std::initializer_list<ListDataType> initList): _head(make_node(*initList.begin(), nullptr)), _tail(_head)
+    ForwardList(std::initializer_list<ListDataType> initList) : ForwardList()
     {
-        auto prev_node = _head;
-        auto initListIter = initList.begin();
-        while (++initListIter != initList.end())
-        {
-            auto new_node = make_node(*initListIter, nullptr);
-            prev_node->_next = new_node;
-            prev_node = new_node;
-        }
-        _tail = make_node(value_type{}, nullptr);   // One past last node
-        prev_node->_next = _tail;
+        insert_after(before_begin(), initList);
     }
 
     // Member Functions: Destructor
-    ~ForwardList() = default;
+    // Single pass over the nodes, skipped entirely when the pool can simply be dropped
+    ~ForwardList()
+    {
+        release_nodes();
+    }
 
     // Member Functions: Assignment Operator and assign
-    ForwardList& operator=(const ForwardList& other) 
+    ForwardList& operator=(const ForwardList& other)
     {
-        _head = make_node(other._head->_value, nullptr);
-        _tail = _head;
-
-        auto next_node = other._head->_next;
-        auto prev_node = _head;
-        while (next_node != other._tail)
+        if (this != &other)
         {
-            auto new_node = make_node(next_node->_value, nullptr);
-            prev_node->_next = new_node;  
-            prev_node = new_node;
-            next_node = next_node->_next;
+            assign_copy(other._before_head._next, nullptr);
         }
-        _tail = make_node(value_type{}, nullptr);   // One past last node
-        prev_node->_next = _tail;
+        return *this;
     }
 
-    ForwardList& operator=(ForwardList&& other) noexcept 
+    ForwardList& operator=(ForwardList&& other) noexcept
     {
-        _head = std::move(other._head);
-        _tail = std::move(other._tail);
-        other._head = nullptr;
-        other._tail = nullptr;
+        // other takes this list's old nodes and pool and frees them when it goes away
+        swap(other);
+        return *this;
     }
 
-    ForwardList& operator=(std::initializer_list<ListDataType> initList) 
+    ForwardList& operator=(std::initializer_list<ListDataType> initList)
     {
-        _head = make_node(*initList.begin(), nullptr);
-        _tail = _head;
-
-        auto prev_node = _head;
-        auto initListIter = initList.begin();
-        while (++initListIter != initList.end())
-        {
-            auto new_node = make_node(*initListIter, nullptr);
-            prev_node->_next = new_node;
-            prev_node = new_node;
-        }
-        _tail = make_node(value_type{}, nullptr);   // One past last node
-        prev_node->_next = _tail;
+        assign(initList);
+        return *this;
     }
 
-    void assign(size_t count, ListDataType value) 
+    void assign(size_t count, const ListDataType& value)
     {
-        _head = make_node(value, nullptr); 
-        _tail = _head;
-
-        auto prev_node = _head;
-        size_t index = 0;
-        while (++index < count)   // pre-increment of index means can use count, not (count - 1)
+        // Reuse existing nodes before allocating or freeing any
+        node_base_pointer prev_node = &_before_head;
+        while (count && prev_node->_next)
+        {
+            prev_node = prev_node->_next;
+            forward_list_node::from_base(prev_node)->_value = value;
+            --count;
+        }
+        if (count)
+        {
+            insert_after(iterator(prev_node), count, value);
+        }
+        else
         {
-            auto new_node = make_node(value, nullptr);
-            prev_node->_next = new_node;
-            prev_node = new_node;
+            erase_after(iterator(prev_node), end());
         }
-        _tail = make_node(value_type{}, nullptr);   // One past last node
-        prev_node->_next = _tail;
     }
-    
+
     // TODO void assign(iterator first, iterator last) {}
-    
-    void assign(std::initializer_list<ListDataType> initList) 
+
+    void assign(std::initializer_list<ListDataType> initList)
     {
-        *this = initList;
+        node_base_pointer prev_node = &_before_head;
+        auto initListIter = initList.begin();
+        while (initListIter != initList.end() && prev_node->_next)
+        {
+            prev_node = prev_node->_next;
+            forward_list_node::from_base(prev_node)->_value = *initListIter;
+            ++initListIter;
+        }
+        erase_after(iterator(prev_node), end());
+        while (initListIter != initList.end())
+        {
+            prev_node = prev_node->_next = make_node(nullptr, *initListIter);
+            ++initListIter;
+        }
     }
 
     // Member Functions: Element Access
-    reference front() 
+    reference front()
     {
-        return _head->_value;
+        return forward_list_node::from_base(_before_head._next)->_value;
     }
 
     const_reference front() const
     {
-        return _head->_value;
+        return forward_list_node::from_base(_before_head._next)->_value;
     }
 
     // Member Functions: Iterators
     iterator before_begin() noexcept
     {
-        auto ret_node = make_node(value_type{}, _head);
-        return iterator(ret_node);
+        return iterator(&_before_head);
+    }
+
+    const_iterator before_begin() const noexcept
+    {
+        return iterator(const_cast<node_base_pointer>(&_before_head));
     }
 
     iterator begin() noexcept
     {
-        return iterator(_head);
+        return iterator(_before_head._next);
     }
 
     const_iterator begin() const noexcept
     {
-        return iterator(_head);
+        return iterator(_before_head._next);
     }
 
     iterator end() noexcept
     {
-        return iterator(_tail);
+        return iterator(nullptr);
     }
 
     const_iterator end() const noexcept
     {
-        return iterator(_tail);
+        return iterator(nullptr);
     }
 
     // Member Functions: Capacity
     bool empty() const noexcept
     {
-        return _head == _tail;
+        return _before_head._next == nullptr;
+    }
+
+    // Constant with ForwardListTrackedSize, otherwise walks the list
+    size_t size() const noexcept
+    {
+        if (SizePolicy::tracks_size)
+        {
+            return this->tracked_size();
+        }
+
+        size_t count = 0;
+        for (auto curr_node = _before_head._next; curr_node; curr_node = curr_node->_next)
+        {
+            ++count;
+        }
+        return count;
     }
 
     // TODO size_t max_size const noexcept {}
@@ -200,109 +209,107 @@ public:
     // Member Functions: Modifiers
     void clear() noexcept
     {
-        // auto node_to_delete = _head;
-        while(_head != _tail)
-        {
-            auto node_to_delete = _head;
-            _head = _head->_next;
-            delete node_to_delete;
-        }
+        erase_after(before_begin(), end());
     }
 
     iterator insert_after(const_iterator pos, const ListDataType& value)
     {
         auto node_before = pos._pointee;
-        auto new_node = make_node(value, node_before->_next);
-        node_before->_next = new_node;
-        return iterator(new_node);
+        node_before->_next = make_node(node_before->_next, value);
+        return iterator(node_before->_next);
     }
 
-    iterator insert_after(const_iterator pos, ListDataType&& value) 
+    iterator insert_after(const_iterator pos, ListDataType&& value)
     {
         auto node_before = pos._pointee;
-        auto new_node = make_node(std::move(value), node_before->_next);
-        node_before->_next = new_node;
-        return iterator(new_node);   
+        node_before->_next = make_node(node_before->_next, std::move(value));
+        return iterator(node_before->_next);
     }
-    
-    iterator insert_after(const_iterator pos, size_t count, const ListDataType& value) 
+
+    // Constructs the new element in place from args
+    template<typename... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args)
     {
         auto node_before = pos._pointee;
-        size_t num_inserted = 0;
-        while(num_inserted < count)
-        {
-            auto new_node = make_node(value, node_before->_next);
-            node_before->_next = new_node;
-            ++num_inserted;
-        }
+        node_before->_next = make_node(node_before->_next, std::forward<Args>(args)...);
         return iterator(node_before->_next);
     }
-    
-    iterator insert_after(const_iterator pos, iterator first, iterator last)
+
+    // Returns iterator to last inserted element, or pos if count is 0
+    iterator insert_after(const_iterator pos, size_t count, const ListDataType& value)
     {
         auto node_before = pos._pointee;
-        auto node_after = pos._pointee->_next;
-        while(first != last)
+        auto node_after = node_before->_next;
+        while (count--)
         {
-            auto new_node = make_node(*first, node_after);
-            node_before->_next = new_node;
-            node_before = new_node;
-            ++first;
+            node_before = node_before->_next = make_node(node_after, value);
         }
-        return iterator(node_before->_next);
+        return iterator(node_before);
+    }
+
+    iterator insert_after(const_iterator pos, iterator first, iterator last)
+    {
+        return iterator(append_copy(pos._pointee, first._pointee, last._pointee));
     }
-    
+
     iterator insert_after(const_iterator pos, std::initializer_list<ListDataType> initList)
     {
         auto node_before = pos._pointee;
-        auto node_after = pos._pointee->_next;
-        for (auto elem : initList)
+        auto node_after = node_before->_next;
+        for (const auto& elem : initList)
         {
-            auto new_node = make_node(elem, node_after);
-            node_before->_next = new_node;
-            node_before = new_node;
+            node_before = node_before->_next = make_node(node_after, elem);
         }
-        return iterator(node_before->_next);
+        return iterator(node_before);
     }
 
-    iterator erase_after(const_iterator pos) 
+    iterator erase_after(const_iterator pos)
     {
-        auto node_after = pos._pointee;
-        auto node_to_point_to = node_after->_next;
-        node_after->_next = node_to_point_to->_next;
-        delete node_to_point_to;
-        return iterator(node_after->_next);
+        auto node_before = pos._pointee;
+        auto node_to_delete = node_before->_next;
+        node_before->_next = node_to_delete->_next;
+        destroy_node(node_to_delete);
+        return iterator(node_before->_next);
     }
 
-    iterator erase_after(const_iterator first, const_iterator last) 
+    iterator erase_after(const_iterator first, const_iterator last)
     {
-        auto node_after = first._pointee;
-        auto node_to_point_to = node_after->_next;
-
-        while(node_to_point_to != last._pointee)
+        auto node_before = first._pointee;
+        auto node_to_delete = node_before->_next;
+        auto ahead_node = prefetch_ahead(node_to_delete);
+        while (node_to_delete != last._pointee)
         {
-            node_after->_next = node_to_point_to->_next;
-            delete node_to_point_to;
-            node_to_point_to = node_after->_next;
+            step_prefetch(ahead_node);
+            auto next_node = node_to_delete->_next;
+            destroy_node(node_to_delete);
+            node_to_delete = next_node;
         }
-        return iterator(node_after->_next);     // Equivalent to returnng last
+        node_before->_next = last._pointee;
+        return last;
     }
 
     void push_front(const ListDataType& value)
     {
-        auto new_node = make_node(value, _head);
-        _head = new_node;        
+        _before_head._next = make_node(_before_head._next, value);
     }
 
     void push_front(ListDataType&& value)
     {
-        auto new_node = make_node(value, _head);
-        _head = new_node;
+        _before_head._next = make_node(_before_head._next, std::move(value));
+    }
+
+    // Constructs the new front element in place from args, returns a reference to it
+    template<typename... Args>
+    reference emplace_front(Args&&... args)
+    {
+        auto node = make_node(_before_head._next, std::forward<Args>(args)...);
+        _before_head._next = node;
+        return node->_value;
     }
 
     void pop_front()
     {
-        _head = _head->_next;
+        erase_after(before_begin());
     }
 
     void resize(size_t count)
@@ -312,186 +319,692 @@ public:
 
     void resize(size_t count, const ListDataType& val)
     {
-        auto curr_size = 0;
-        auto iter = begin();
-        auto eraseIter = begin();
-        while (iter != end())
-        {
-            ++iter;
-            ++curr_size;
-
-            if (curr_size < count)
-            {
-                ++eraseIter;
-            }
-        }
-        if (curr_size == count) 
+        if (SizePolicy::tracks_size && count == this->tracked_size())
         {
             return;
         }
 
-        if (curr_size > count)
+        // Walk to the count-th node, then either cut the rest or append the shortfall
+        node_base_pointer prev_node = &_before_head;
+        while (count && prev_node->_next)
         {
-            erase_after(eraseIter, end());
-        } 
-
-        if (curr_size < count)
+            prev_node = prev_node->_next;
+            --count;
+        }
+        if (count)
         {
-            while (curr_size != count)
-            {
-                insert_after(iter, ListDataType{});
-                ++iter;
-                ++curr_size;
-            }  
+            insert_after(iterator(prev_node), count, val);
+        }
+        else
+        {
+            erase_after(iterator(prev_node), end());
         }
     }
 
     void swap(ForwardList& other) noexcept
     {
         using std::swap;
-        swap(_head, other._head);
-        swap(_tail, other._tail);
+        swap(_pool, other._pool);
+        swap(_before_head._next, other._before_head._next);
+
+        auto size = this->tracked_size();
+        this->set_size(other.tracked_size());
+        other.set_size(size);
     }
 
     // Member Functions: Operations
-    
-    void merge(ForwardList& other) 
+
+    void merge(ForwardList& other)
     {
-        auto iter = begin();
-        auto otherIter = other.begin();
-        auto traverse_node = make_node(ListDataType{}, nullptr);
-        auto new_head = traverse_node;
+        merge(other, std::less<value_type>());
+    }
 
-        size_t count = 0;
-        while (iter != end() && otherIter != other.end())
-        {
-            if (*iter <= *otherIter)
-            {
-                traverse_node->_next = iter._pointee;
-                ++iter;
-            } else {
-                traverse_node->_next = otherIter._pointee;
-                ++otherIter;
-            }
-            ++count;
-            traverse_node = traverse_node->_next;
-        }
+    void merge(ForwardList&& other)
+    {
+        merge(other, std::less<value_type>());
+    }
 
-        while (iter != end())
+    // Stable: for equivalent elements, this list's come first. Relinks nodes, nothing is copied or allocated.
+    template<typename Compare>
+    void merge(ForwardList& other, Compare comp)
+    {
+        if (this == &other)
         {
-            traverse_node->_next = iter._pointee;
-            ++iter;
-            traverse_node = traverse_node->_next;
+            return;
         }
+        join_pool(other);
+        _before_head._next = merge_runs(_before_head._next, other._before_head._next, comp);
+
+        // All of other's nodes now belong to this list
+        other._before_head._next = nullptr;
+        transfer_size(other, other.tracked_size());
+    }
 
-        while (otherIter != other.end())
+    template<typename Compare>
+    void merge(ForwardList&& other, Compare comp)
+    {
+        merge(other, comp);
+    }
+    // splice_after only relinks nodes, values are neither copied nor moved and iterators to them stay valid.
+    // Moving a single element is O(1); moving a range or a whole list walks it once to find its last node.
+
+    // Move all of other after pos
+    void splice_after(const_iterator pos, ForwardList& other)
+    {
+        splice_after(pos, other, other.before_begin(), other.end());
+    }
+
+    void splice_after(const_iterator pos, ForwardList&& other)
+    {
+        splice_after(pos, other);
+    }
+
+    // Move the element after it (which may be in this list) after pos
+    void splice_after(const_iterator pos, ForwardList& other, const_iterator it)
+    {
+        auto node_before = it._pointee;
+        auto node = node_before->_next;
+        if (!node || pos._pointee == node_before || pos._pointee == node)
         {
-            traverse_node->_next = otherIter._pointee;
-            ++otherIter;
-            traverse_node = traverse_node->_next;
+            return;
         }
-        _head = new_head->_next;
+        join_pool(other);
+
+        node_before->_next = node->_next;
+        node->_next = pos._pointee->_next;
+        pos._pointee->_next = node;
+        transfer_size(other, 1);
+    }
+
+    void splice_after(const_iterator pos, ForwardList&& other, const_iterator it)
+    {
+        splice_after(pos, other, it);
     }
 
-    // TODO void merge(ForwardList&& other) {}
-    // TODO void splice_after(const_iterator pos, ForwardList& other) {}
-    // TODO void splice_after(const_iterator pos, ForwardList&& other) {}
-    // TODO void splice_after(const_iterator pos, ForwardList& other, const_iterator it) {}
-    // TODO void splice_after(const_iterator pos, ForwardList&& other, const_iterator it) {}
-    // TODO void splice_after(const_iterator pos, ForwardList& other, const_iterator first, const_iterator last) {}
-    // TODO void splice_after(const_iterator pos, ForwardList&& other, const_iterator first, const_iterator last) {}
-    
-    void remove(const ListDataType& value) 
+    // Move the elements in (first, last) after pos, pos must not be inside that range
+    void splice_after(const_iterator pos, ForwardList& other, const_iterator first, const_iterator last)
     {
-        auto traverse_node = begin();
-        while (traverse_node != end())
+        auto node_before = first._pointee;
+        auto first_node = node_before->_next;
+        if (first_node == last._pointee)
         {
-            if (traverse_node._pointee->_next->_value == value)
-            {
-                erase_after(traverse_node);
-            }
-            ++traverse_node; 
+            return;
+        }
+        join_pool(other);
+
+        auto last_node = first_node;
+        size_t count = 1;
+        while (last_node->_next != last._pointee)
+        {
+            last_node = last_node->_next;
+            ++count;
         }
+
+        node_before->_next = last._pointee;
+        last_node->_next = pos._pointee->_next;
+        pos._pointee->_next = first_node;
+        transfer_size(other, count);
+    }
+
+    void splice_after(const_iterator pos, ForwardList&& other, const_iterator first, const_iterator last)
+    {
+        splice_after(pos, other, first, last);
     }
 
-    void reverse() noexcept 
+    // Bulk removals make one pass that prefetches ahead of the traversal and frees unlinked nodes in batches.
+    // value may refer to an element of this list, its node is destroyed last.
+    void remove(const ListDataType& value)
     {
-        auto prev_node = make_node(ListDataType{}, nullptr); 
-        auto curr_node = _head; 
-        auto next_node = make_node(ListDataType{}, nullptr);
-        while (curr_node->_next != nullptr)
+        remove_nodes_if([&value](const value_type& elem) { return elem == value; }, &value);
+    }
+
+    template<typename UnaryPredicate>
+    void remove_if(UnaryPredicate pred)
+    {
+        remove_nodes_if(pred, nullptr);
+    }
+
+    void reverse() noexcept
+    {
+        node_base_pointer prev_node = nullptr;
+        auto curr_node = _before_head._next;
+        while (curr_node)
         {
-            next_node = curr_node->_next;
+            auto next_node = curr_node->_next;
             curr_node->_next = prev_node;
             prev_node = curr_node;
             curr_node = next_node;
         }
-        _head = prev_node;
+        _before_head._next = prev_node;
     }
-    
+
     void unique()
     {
-        auto curr_node = _head->_next;
-        auto prev_node = _head;
-        auto next_node = _head;
+        unique(std::equal_to<value_type>());
+    }
+
+    // Keeps the first of each run of consecutive elements for which pred(first, element) holds
+    template<typename BinaryPredicate>
+    void unique(BinaryPredicate pred)
+    {
+        auto prev_node = _before_head._next;
+        if (!prev_node)
+        {
+            return;
+        }
 
-        while (prev_node != _tail)
+        node_batch unlinked(*this);
+        auto ahead_node = prefetch_ahead(prev_node);
+        while (auto curr_node = prev_node->_next)
         {
-            next_node = curr_node->_next;
-            if (prev_node->_value == curr_node->_value)
+            step_prefetch(ahead_node);
+            if (pred(forward_list_node::from_base(prev_node)->_value, forward_list_node::from_base(curr_node)->_value))
             {
-                // Remove curr_node
-                delete curr_node;
-                prev_node->_next = next_node;    
+                prev_node->_next = curr_node->_next;
+                unlinked.push(curr_node);
             } else {
                 prev_node = curr_node;
             }
+        }
+    }
+
+    void sort()
+    {
+        sort(std::less<value_type>());
+    }
+
+    // Stable, O(n log n) bottom-up merge sort that relinks nodes in place, no allocation or copies.
+    // runs[i] holds a sorted run of 2^i nodes; each node is merged up through the occupied runs like a
+    // binary counter increment, so at most log2(n) runs exist at once.
+    template<typename Compare>
+    void sort(Compare comp)
+    {
+        const size_t MAX_RUNS = sizeof(size_t) * 8;
+        node_base_pointer runs[MAX_RUNS] = {};
+        size_t run_count = 0;
+
+        auto curr_node = _before_head._next;
+        while (curr_node)
+        {
+            auto next_node = curr_node->_next;
+            curr_node->_next = nullptr;
+
+            // Older runs hold earlier elements, so they go first to keep the sort stable
+            node_base_pointer carry = curr_node;
+            size_t index = 0;
+            while (index < run_count && runs[index])
+            {
+                carry = merge_runs(runs[index], carry, comp);
+                runs[index] = nullptr;
+                ++index;
+            }
+            if (index == run_count)
+            {
+                ++run_count;
+            }
+            runs[index] = carry;
             curr_node = next_node;
         }
+
+        node_base_pointer sorted = nullptr;
+        for (size_t index = 0; index < run_count; ++index)
+        {
+            if (runs[index])
+            {
+                sorted = sorted ? merge_runs(runs[index], sorted, comp) : runs[index];
+            }
+        }
+        _before_head._next = sorted;
+    }
+
+    // Member Functions: Allocation
+    // Pool backing this list's nodes, may be passed to other lists to share it
+    node_pool_pointer get_pool()
+    {
+        pool();
+        return _pool;
+    }
+
+    // Moves every element into one new contiguous slab in iteration order, so traversal walks memory
+    // sequentially again after churn or sort() scattered the nodes. Order and values are kept; elements are
+    // moved if that cannot throw and copied otherwise, and if a copy throws the list is left unchanged.
+    // The list then has a pool of its own: other lists sharing the old one keep it. Invalidates iterators.
+    void compact()
+    {
+        auto count = size();
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto slab_pool = std::make_shared<node_pool>();
+        slab_pool->reserve_contiguous(count);
+        node_base slab_head(nullptr);
+        node_base_pointer slab_tail = &slab_head;
+        try
+        {
+            for (auto curr_node = _before_head._next; curr_node; curr_node = curr_node->_next)
+            {
+                auto& value = forward_list_node::from_base(curr_node)->_value;
+                slab_tail = slab_tail->_next = new (slab_pool->allocate()) forward_list_node(nullptr, std::move_if_noexcept(value));
+            }
+        }
+        catch (...)
+        {
+            // Values copied so far go away with the slab
+            for (auto curr_node = slab_head._next; curr_node; curr_node = curr_node->_next)
+            {
+                forward_list_node::from_base(curr_node)->~forward_list_node();
+            }
+            throw;
+        }
+
+        release_nodes();
+        _pool = std::move(slab_pool);
+        _before_head._next = slab_head._next;
+        this->set_size(count);
     }
 
-    // TODO void sort() {}
+    // Average distance between the addresses of consecutive nodes, in node sizes: 1 when the nodes sit
+    // back to back in iteration order, as after compact(), and growing as they scatter. 1 for fewer than
+    // two elements. Walks the list.
+    double locality_score() const noexcept
+    {
+        double distance = 0;
+        size_t pairs = 0;
+        for (auto curr_node = _before_head._next; curr_node && curr_node->_next; curr_node = curr_node->_next)
+        {
+            auto curr_address = reinterpret_cast<uintptr_t>(curr_node);
+            auto next_address = reinterpret_cast<uintptr_t>(curr_node->_next);
+            distance += next_address > curr_address ? next_address - curr_address : curr_address - next_address;
+            ++pairs;
+        }
+        return pairs ? distance / pairs / sizeof(forward_list_node) : 1.0;
+    }
 
     // Non-Member Functions: Relational operators, swap declaration
-    template<class myListDataType> 
-    friend bool operator==(const ForwardList<myListDataType>& lhs, const ForwardList<myListDataType>& rhs);
+    template<class myListDataType, class mySizePolicy>
+    friend bool operator==(const ForwardList<myListDataType, mySizePolicy>& lhs, const ForwardList<myListDataType, mySizePolicy>& rhs);
 
-    template<class myListDataType> 
-    friend bool operator!=(const ForwardList<myListDataType>& lhs, const ForwardList<myListDataType>& rhs);
+    template<class myListDataType, class mySizePolicy>
+    friend bool operator!=(const ForwardList<myListDataType, mySizePolicy>& lhs, const ForwardList<myListDataType, mySizePolicy>& rhs);
 
-    template<class myListDataType> 
-    friend bool operator<(const ForwardList<myListDataType>& lhs, const ForwardList<myListDataType>& rhs);
+    template<class myListDataType, class mySizePolicy>
+    friend bool operator<(const ForwardList<myListDataType, mySizePolicy>& lhs, const ForwardList<myListDataType, mySizePolicy>& rhs);
 
-    template<class myListDataType> 
-    friend bool operator>(const ForwardList<myListDataType>& lhs, const ForwardList<myListDataType>& rhs);
+    template<class myListDataType, class mySizePolicy>
+    friend bool operator>(const ForwardList<myListDataType, mySizePolicy>& lhs, const ForwardList<myListDataType, mySizePolicy>& rhs);
 
-    template<class myListDataType> 
-    friend bool operator<=(const ForwardList<myListDataType>& lhs, const ForwardList<myListDataType>& rhs);
+    template<class myListDataType, class mySizePolicy>
+    friend bool operator<=(const ForwardList<myListDataType, mySizePolicy>& lhs, const ForwardList<myListDataType, mySizePolicy>& rhs);
 
-    template<class myListDataType> 
-    friend bool operator>=(const ForwardList<myListDataType>& lhs, const ForwardList<myListDataType>& rhs);
+    template<class myListDataType, class mySizePolicy>
+    friend bool operator>=(const ForwardList<myListDataType, mySizePolicy>& lhs, const ForwardList<myListDataType, mySizePolicy>& rhs);
 
-    template<class myListDataType> 
-    friend void swap(ForwardList<myListDataType>& lhs, ForwardList<myListDataType>& rhs) noexcept;
+    template<class myListDataType, class mySizePolicy>
+    friend void swap(ForwardList<myListDataType, mySizePolicy>& lhs, ForwardList<myListDataType, mySizePolicy>& rhs) noexcept;
 
 private:
-    node_pointer _head;
-    node_pointer _tail;
+    // Nodes a bulk traversal prefetches ahead of the one it works on, and nodes it unlinks before freeing them
+    static const size_t PREFETCH_DISTANCE = 4;
+    static const size_t FREE_BATCH = 64;
+
+    // Unlinked nodes, destroyed FREE_BATCH at a time while they are still in cache and when the batch
+    // goes out of scope, also if a predicate throws
+    class node_batch
+    {
+    public:
+        explicit node_batch(ForwardList& list) noexcept : _list(list), _count(0) {};
+        node_batch(const node_batch& other) = delete;
+        node_batch& operator=(const node_batch& other) = delete;
+
+        ~node_batch()
+        {
+            flush();
+        }
+
+        void push(node_base_pointer node) noexcept
+        {
+            _nodes[_count++] = node;
+            if (_count == FREE_BATCH)
+            {
+                flush();
+            }
+        }
+
+        void flush() noexcept
+        {
+            for (size_t index = 0; index < _count; ++index)
+            {
+                _list.destroy_node(_nodes[index]);
+            }
+            _count = 0;
+        }
+
+    private:
+        ForwardList& _list;
+        node_base_pointer _nodes[FREE_BATCH];
+        size_t _count;
+    };
+
+    node_pool_pointer _pool;
+    node_base _before_head;     // Sentinel before the first node, _before_head._next == nullptr when empty
+
+    node_pool& pool()
+    {
+        if (!_pool)
+        {
+            _pool = std::make_shared<node_pool>();
+        }
+        else if (_pool->is_forwarded())
+        {
+            // Only after another list joined this pool; the common case touches no reference count
+            _pool = node_pool::root(std::move(_pool));
+        }
+        return *_pool;
+    }
+
+    // Called before relinking other's nodes into this list
+    void join_pool(ForwardList& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+        pool();
+        other.pool();
+        _pool = node_pool::join(_pool, other._pool);
+        other._pool = _pool;
+    }
+
+    // Called after count nodes were relinked from other into this list
+    void transfer_size(ForwardList& other, size_t count) noexcept
+    {
+        if (this != &other)
+        {
+            this->add_size(count);
+            other.sub_size(count);
+        }
+    }
+
+    // Destroys every node, single pass, skipped entirely when the pool can simply be dropped. Leaves the
+    // list without nodes or pool.
+    void release_nodes() noexcept
+    {
+        _pool = node_pool::root(std::move(_pool));
+        auto curr_node = _before_head._next;
+        _before_head._next = nullptr;
+        if (!_pool || (_pool.use_count() == 1 && std::is_trivially_destructible<value_type>::value))
+        {
+            _pool.reset();
+            return;
+        }
+
+        auto sole_owner = _pool.use_count() == 1;
+        auto ahead_node = prefetch_ahead(curr_node);
+        while (curr_node)
+        {
+            step_prefetch(ahead_node);
+            auto next_node = curr_node->_next;
+            if (sole_owner)
+            {
+                forward_list_node::from_base(curr_node)->~forward_list_node();
+            }
+            else
+            {
+                destroy_node(curr_node);
+            }
+            curr_node = next_node;
+        }
+        _pool.reset();
+    }
+
+    // Every node made is linked into this list and every node destroyed is unlinked from it,
+    // so these two keep the size policy up to date
+    template<typename... Args>
+    node_pointer make_node(node_base_pointer node_ptr, Args&&... args)
+    {
+        auto slot = pool().allocate();
+        node_pointer node;
+        try
+        {
+            node = new (slot) forward_list_node(node_ptr, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            pool().deallocate(slot);
+            throw;
+        }
+        this->add_size(1);
+        return node;
+    }
+
+    void destroy_node(node_base_pointer node) noexcept
+    {
+        forward_list_node::from_base(node)->~forward_list_node();
+        pool().deallocate(node);
+        this->sub_size(1);
+    }
+
+    static void prefetch(const void* address) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    // A bulk traversal keeps a lookahead node PREFETCH_DISTANCE nodes past the one it works on and steps it
+    // once per node, prefetching each node it reaches. Chasing the links stays serial, but the node's value
+    // and the work on it overlap with the misses further down the list. Nodes behind the lookahead may be
+    // unlinked and freed; it never points at one.
+    static node_base_pointer prefetch_ahead(node_base_pointer node) noexcept
+    {
+        for (size_t distance = 0; distance < PREFETCH_DISTANCE && node; ++distance)
+        {
+            node = node->_next;
+            prefetch(node);
+        }
+        return node;
+    }
 
-    node_pointer make_node(value_type val, node_pointer node_ptr)
+    static void step_prefetch(node_base_pointer& ahead_node) noexcept
     {
-        return new stlcontainer::ForwardListNode<ListDataType>(val, node_ptr);
+        if (ahead_node)
+        {
+            ahead_node = ahead_node->_next;
+            prefetch(ahead_node);
+        }
+    }
+
+    // Unlinks and frees every node whose value satisfies pred. The node holding *deferred_value, if any,
+    // is freed after the pass since pred may still read it.
+    template<typename UnaryPredicate>
+    void remove_nodes_if(UnaryPredicate pred, const value_type* deferred_value)
+    {
+        node_batch deferred(*this);
+        node_batch unlinked(*this);
+        node_base_pointer prev_node = &_before_head;
+        auto ahead_node = prefetch_ahead(prev_node->_next);
+        while (auto curr_node = prev_node->_next)
+        {
+            step_prefetch(ahead_node);
+            auto& value = forward_list_node::from_base(curr_node)->_value;
+            if (pred(value))
+            {
+                prev_node->_next = curr_node->_next;
+                (&value == deferred_value ? deferred : unlinked).push(curr_node);
+            } else {
+                prev_node = curr_node;
+            }
+        }
+    }
+
+    // Element-wise ==, for operator== and operator!=
+    static bool equal(const ForwardList& lhs, const ForwardList& rhs)
+    {
+        if (SizePolicy::tracks_size && lhs.tracked_size() != rhs.tracked_size())
+        {
+            return false;
+        }
+
+        auto lhs_node = lhs._before_head._next;
+        auto rhs_node = rhs._before_head._next;
+        while (lhs_node && rhs_node)
+        {
+            if (!(forward_list_node::from_base(lhs_node)->_value == forward_list_node::from_base(rhs_node)->_value))
+            {
+                return false;
+            }
+            lhs_node = lhs_node->_next;
+            rhs_node = rhs_node->_next;
+        }
+        return lhs_node == rhs_node;
+    }
+
+    // Lexicographic comparison using only <: negative, zero or positive as lhs orders before, equal to or after rhs
+    static int compare(const ForwardList& lhs, const ForwardList& rhs)
+    {
+        auto lhs_node = lhs._before_head._next;
+        auto rhs_node = rhs._before_head._next;
+        while (lhs_node && rhs_node)
+        {
+            const auto& lhs_value = forward_list_node::from_base(lhs_node)->_value;
+            const auto& rhs_value = forward_list_node::from_base(rhs_node)->_value;
+            if (lhs_value < rhs_value)
+            {
+                return -1;
+            }
+            if (rhs_value < lhs_value)
+            {
+                return 1;
+            }
+            lhs_node = lhs_node->_next;
+            rhs_node = rhs_node->_next;
+        }
+        return lhs_node ? 1 : (rhs_node ? -1 : 0);
+    }
+
+    // Merges two null-terminated sorted chains, taking from first unless second is strictly less
+    template<typename Compare>
+    static node_base_pointer merge_runs(node_base_pointer first, node_base_pointer second, Compare& comp)
+    {
+        node_base merged(nullptr);
+        node_base_pointer tail_node = &merged;
+        while (first && second)
+        {
+            if (comp(forward_list_node::from_base(second)->_value, forward_list_node::from_base(first)->_value))
+            {
+                tail_node->_next = second;
+                second = second->_next;
+            } else {
+                tail_node->_next = first;
+                first = first->_next;
+            }
+            tail_node = tail_node->_next;
+        }
+        tail_node->_next = first ? first : second;
+        return merged._next;
+    }
+
+    // Copies values of [first, last) after node_before, returns the last inserted node
+    node_base_pointer append_copy(node_base_pointer node_before, node_base_pointer first, node_base_pointer last)
+    {
+        auto node_after = node_before->_next;
+        while (first != last)
+        {
+            node_before = node_before->_next = make_node(node_after, forward_list_node::from_base(first)->_value);
+            first = first->_next;
+        }
+        return node_before;
+    }
+
+    // Overwrites existing values with [first, last), then trims or extends the list
+    void assign_copy(node_base_pointer first, node_base_pointer last)
+    {
+        node_base_pointer prev_node = &_before_head;
+        while (first != last && prev_node->_next)
+        {
+            prev_node = prev_node->_next;
+            forward_list_node::from_base(prev_node)->_value = forward_list_node::from_base(first)->_value;
+            first = first->_next;
+        }
+        erase_after(iterator(prev_node), end());
+        append_copy(prev_node, first, last);
     }
 };
 
-// Non-Member Functions
+// Non-Member Functions: Relational Operators
+// == stops at the first mismatch, and right away on differing sizes when both sizes are tracked. The ordering
+// operators share one lexicographic pass that stops at the first element pair that decides it.
+template <class ListDataType, class SizePolicy>
+bool operator==(const ForwardList<ListDataType, SizePolicy>& lhs, const ForwardList<ListDataType, SizePolicy>& rhs)
+{
+    return ForwardList<ListDataType, SizePolicy>::equal(lhs, rhs);
+}
+
+template <class ListDataType, class SizePolicy>
+bool operator!=(const ForwardList<ListDataType, SizePolicy>& lhs, const ForwardList<ListDataType, SizePolicy>& rhs)
+{
+    return !ForwardList<ListDataType, SizePolicy>::equal(lhs, rhs);
+}
+
+template <class ListDataType, class SizePolicy>
+bool operator<(const ForwardList<ListDataType, SizePolicy>& lhs, const ForwardList<ListDataType, SizePolicy>& rhs)
+{
+    return ForwardList<ListDataType, SizePolicy>::compare(lhs, rhs) < 0;
+}
 
-// TODO relational operators
+template <class ListDataType, class SizePolicy>
+bool operator>(const ForwardList<ListDataType, SizePolicy>& lhs, const ForwardList<ListDataType, SizePolicy>& rhs)
+{
+    return ForwardList<ListDataType, SizePolicy>::compare(lhs, rhs) > 0;
+}
 
-template <class ListDataType>
-void swap(ForwardList<ListDataType>& lhs, ForwardList<ListDataType>& rhs) noexcept
+template <class ListDataType, class SizePolicy>
+bool operator<=(const ForwardList<ListDataType, SizePolicy>& lhs, const ForwardList<ListDataType, SizePolicy>& rhs)
+{
+    return ForwardList<ListDataType, SizePolicy>::compare(lhs, rhs) <= 0;
+}
+
+template <class ListDataType, class SizePolicy>
+bool operator>=(const ForwardList<ListDataType, SizePolicy>& lhs, const ForwardList<ListDataType, SizePolicy>& rhs)
+{
+    return ForwardList<ListDataType, SizePolicy>::compare(lhs, rhs) >= 0;
+}
+
+// Non-Member Functions: swap
+
+template <class ListDataType, class SizePolicy>
+void swap(ForwardList<ListDataType, SizePolicy>& lhs, ForwardList<ListDataType, SizePolicy>& rhs) noexcept
 {
     lhs.swap(rhs);
 }
 
-} // namespace stlcontainer
\ No newline at end of file
+// ForwardList with a constant-time size()
+template <class ListDataType>
+using SizedForwardList = ForwardList<ListDataType, stlcontainer::ForwardListTrackedSize>;
+
+} // namespace stlcontainer
+
+namespace std
+{
+
+// Combines the element hashes in order in one pass, so equal lists hash equal and reordered ones rarely do
+template <class ListDataType, class SizePolicy>
+struct hash<stlcontainer::ForwardList<ListDataType, SizePolicy>>
+{
+    size_t operator()(const stlcontainer::ForwardList<ListDataType, SizePolicy>& list) const
+    {
+        std::hash<ListDataType> element_hash;
+        size_t seed = 0;
+        for (const auto& elem : list)
+        {
+            // boost::hash_combine, with the 64-bit golden ratio constant where size_t allows
+            seed ^= element_hash(elem) + static_cast<size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
+} // namespace std
+
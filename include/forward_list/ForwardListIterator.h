@@ -1,3 +1,5 @@
+#pragma once
+#include <cstddef>
 #include <iterator>
 #include "ForwardListNode.h"
 
@@ -8,11 +10,12 @@ template<typename IterType>
 class ForwardListIterator : public std::iterator<
     std::forward_iterator_tag,
     IterType, 
+    std::ptrdiff_t,
     IterType*, 
     IterType&>
 {
 // Friend declarations
-friend class ForwardList<IterType>;
+template <typename T, typename SizePolicy> friend class ForwardList;
 
 // Type definitions
 public:
@@ -27,7 +30,7 @@ public:
     // Deference
     reference operator* () const
     {
-        return _pointee->_value;
+        return ForwardListNode<IterType>::from_base(_pointee)->_value;
     }
 
     // Increment/move
@@ -58,8 +61,8 @@ public:
     } 
 
 private:
-    stlcontainer::ForwardListNode<IterType>* _pointee;
-    explicit ForwardListIterator(stlcontainer::ForwardListNode<IterType>* pointee): _pointee(pointee) {};
+    stlcontainer::ForwardListNodeBase<IterType>* _pointee;     // nullptr is end()
+    explicit ForwardListIterator(stlcontainer::ForwardListNodeBase<IterType>* pointee): _pointee(pointee) {};
 };
 
 }
\ No newline at end of file
@@ -1,15 +1,37 @@
-namespace stlcontainer 
+#pragma once
+#include <utility>
+
+namespace stlcontainer
 {
 
-template <typename T> class ForwardList;
+template <typename T, typename SizePolicy> class ForwardList;
 template <typename T> class ForwardListIterator;
+template <typename T> class ForwardListNode;
+
+// Link part of a node. ForwardList embeds one as its before-head sentinel, so the sentinel holds no value
+// and needs no allocation. A nullptr link marks the end of the list.
+template<typename NodeType>
+class ForwardListNodeBase
+{
+// Friend declarations
+friend class ForwardListIterator<NodeType>;
+template <typename T, typename SizePolicy> friend class ForwardList;
+friend class ForwardListNode<NodeType>;
+
+private:
+    stlcontainer::ForwardListNodeBase<NodeType>* _next;
+
+    // Constructor and destructor
+    explicit ForwardListNodeBase(stlcontainer::ForwardListNodeBase<NodeType>* next = nullptr): _next(next) {};
+    ~ForwardListNodeBase() = default;
+};
 
 template<typename NodeType>
-class ForwardListNode
+class ForwardListNode : public ForwardListNodeBase<NodeType>
 {
 // Friend declarations
 friend class ForwardListIterator<NodeType>;
-friend class ForwardList<NodeType>;
+template <typename T, typename SizePolicy> friend class ForwardList;
 
 // Type definitions
 public:
@@ -19,11 +41,18 @@ public:
 
 private:
     value_type _value;
-    stlcontainer::ForwardListNode<NodeType>* _next;
 
     // Constructor and destructor
-    ForwardListNode(const_reference value = value_type{}, stlcontainer::ForwardListNode<NodeType>* next = nullptr): _value(value), _next(next) {};
+    // The value is constructed in place from args, so inserting an rvalue moves it and emplacing copies nothing
+    template<typename... Args>
+    explicit ForwardListNode(stlcontainer::ForwardListNodeBase<NodeType>* next, Args&&... args)
+        : ForwardListNodeBase<NodeType>(next), _value(std::forward<Args>(args)...) {};
     ~ForwardListNode() = default;
+
+    static ForwardListNode* from_base(ForwardListNodeBase<NodeType>* base) noexcept
+    {
+        return static_cast<ForwardListNode*>(base);
+    }
 };
 
-} // namespace stlcontainer
\ No newline at end of file
+} // namespace stlcontainer
@@ -0,0 +1,210 @@
+#pragma once
+#include "stddef.h"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace stlcontainer
+{
+
+// Slab allocator for list nodes. Storage is carved out of chunks of contiguous node slots (chunk sizes
+// double from MIN_CHUNK_NODES up to max_chunk_nodes), freed slots are recycled through an intrusive free
+// list, and every chunk is released at once when the pool is destroyed.
+//
+// Pools can be joined so that nodes may be relinked between lists that were built on different pools:
+// the surviving (root) pool takes ownership of the other pool's chunks and the other pool forwards to it.
+// Forwarding only ever points at a root, so the shared_ptr chain never forms a cycle.
+//
+// Not thread-safe, same as the containers using it.
+template<typename NodeType>
+class ForwardListNodePool
+{
+public:
+    using pool_pointer = std::shared_ptr<ForwardListNodePool<NodeType>>;
+
+    static const size_t MIN_CHUNK_NODES = 16;
+    static const size_t DEFAULT_MAX_CHUNK_NODES = 4096;
+
+public:
+    // Member Functions: Constructors
+    explicit ForwardListNodePool(size_t max_chunk_nodes = DEFAULT_MAX_CHUNK_NODES) noexcept
+        : _max_chunk_nodes(max_chunk_nodes < MIN_CHUNK_NODES ? size_t(MIN_CHUNK_NODES) : max_chunk_nodes) {};
+
+    ForwardListNodePool(const ForwardListNodePool& other) = delete;
+    ForwardListNodePool& operator=(const ForwardListNodePool& other) = delete;
+
+    // Member Functions: Destructor
+    // Bulk release, node destructors are not run
+    ~ForwardListNodePool()
+    {
+        while (_chunks)
+        {
+            auto next_chunk = _chunks->_next;
+            ::operator delete(_chunks);
+            _chunks = next_chunk;
+        }
+    }
+
+    // Member Functions: Allocation
+    // Uninitialized storage for one NodeType
+    void* allocate()
+    {
+        if (_free)
+        {
+            auto slot = _free;
+            _free = _free->_next;
+            return slot;
+        }
+        if (_bump == _bump_end)
+        {
+            add_chunk();
+        }
+        return _bump++;
+    }
+
+    // Makes the next count allocations that miss the free list come from one chunk, in address order.
+    // Unused slots of the current chunk go to the free list.
+    void reserve_contiguous(size_t count)
+    {
+        if (static_cast<size_t>(_bump_end - _bump) >= count)
+        {
+            return;
+        }
+        while (_bump != _bump_end)
+        {
+            deallocate(_bump++);
+        }
+        add_chunk(count);
+    }
+
+    // Storage must come from this pool or one joined into it, NodeType must already be destroyed
+    void deallocate(void* node) noexcept
+    {
+        auto slot = static_cast<slot_type*>(node);
+        slot->_next = _free;
+        _free = slot;
+    }
+
+    // Member Functions: Joining
+    // True when this pool has been joined into another and forwards to it
+    bool is_forwarded() const noexcept
+    {
+        return _forward != nullptr;
+    }
+
+    // Pool that currently owns this pool's chunks
+    static pool_pointer root(pool_pointer pool) noexcept
+    {
+        while (pool && pool->_forward)
+        {
+            pool = pool->_forward;
+        }
+        return pool;
+    }
+
+    // Make both pools share lhs's root, returns the shared root
+    static pool_pointer join(pool_pointer lhs, pool_pointer rhs)
+    {
+        lhs = root(std::move(lhs));
+        rhs = root(std::move(rhs));
+        if (lhs == rhs || !rhs)
+        {
+            return lhs;
+        }
+
+        // Adopt rhs's chunks
+        if (rhs->_chunks)
+        {
+            auto last_chunk = rhs->_chunks;
+            while (last_chunk->_next)
+            {
+                last_chunk = last_chunk->_next;
+            }
+            last_chunk->_next = lhs->_chunks;
+            lhs->_chunks = rhs->_chunks;
+        }
+
+        // Recycle rhs's free slots and its unused bump region
+        while (rhs->_free)
+        {
+            auto slot = rhs->_free;
+            rhs->_free = slot->_next;
+            lhs->deallocate(slot);
+        }
+        while (rhs->_bump != rhs->_bump_end)
+        {
+            lhs->deallocate(rhs->_bump++);
+        }
+
+        lhs->_chunk_count += rhs->_chunk_count;
+        lhs->_capacity += rhs->_capacity;
+        rhs->_chunks = nullptr;
+        rhs->_chunk_count = 0;
+        rhs->_capacity = 0;
+        rhs->_forward = lhs;
+        return lhs;
+    }
+
+    // Member Functions: Capacity
+    // Number of node slots owned, in use or free
+    size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    size_t chunk_count() const noexcept
+    {
+        return _chunk_count;
+    }
+
+private:
+    // A slot holds either a live node or a free list link. The first slot of every chunk links the chunks.
+    union slot_type
+    {
+        slot_type* _next;
+        typename std::aligned_storage<sizeof(NodeType), alignof(NodeType)>::type _storage;
+    };
+
+    static_assert(alignof(slot_type) <= alignof(std::max_align_t), "Over-aligned nodes are not supported");
+
+    slot_type* _chunks = nullptr;
+    slot_type* _free = nullptr;
+    slot_type* _bump = nullptr;         // Next never-used slot of the newest chunk
+    slot_type* _bump_end = nullptr;
+    size_t _next_chunk_nodes = MIN_CHUNK_NODES;
+    size_t _max_chunk_nodes;
+    size_t _chunk_count = 0;
+    size_t _capacity = 0;
+    pool_pointer _forward;
+
+    void add_chunk()
+    {
+        add_chunk(_next_chunk_nodes);
+        if (_next_chunk_nodes < _max_chunk_nodes)
+        {
+            _next_chunk_nodes = (_next_chunk_nodes * 2 < _max_chunk_nodes) ? _next_chunk_nodes * 2 : _max_chunk_nodes;
+        }
+    }
+
+    void add_chunk(size_t nodes)
+    {
+        auto chunk = static_cast<slot_type*>(::operator new(sizeof(slot_type) * (nodes + 1)));
+        chunk->_next = _chunks;
+        _chunks = chunk;
+        _bump = chunk + 1;
+        _bump_end = _bump + nodes;
+
+        ++_chunk_count;
+        _capacity += nodes;
+    }
+};
+
+template<typename NodeType>
+const size_t ForwardListNodePool<NodeType>::MIN_CHUNK_NODES;
+
+template<typename NodeType>
+const size_t ForwardListNodePool<NodeType>::DEFAULT_MAX_CHUNK_NODES;
+
+} // namespace stlcontainer
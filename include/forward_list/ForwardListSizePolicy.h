@@ -0,0 +1,38 @@
+#pragma once
+#include "stddef.h"
+
+namespace stlcontainer
+{
+
+// Size policies for ForwardList. The list derives from its policy and reports every node it creates,
+// destroys or transfers; with the tracked policy size() is O(1) at the cost of a counter.
+
+// Default, same layout as std::forward_list: no counter, size() walks the list
+class ForwardListUntrackedSize
+{
+public:
+    static const bool tracks_size = false;
+
+protected:
+    void add_size(size_t) noexcept {}
+    void sub_size(size_t) noexcept {}
+    void set_size(size_t) noexcept {}
+    size_t tracked_size() const noexcept { return 0; }
+};
+
+class ForwardListTrackedSize
+{
+public:
+    static const bool tracks_size = true;
+
+protected:
+    void add_size(size_t count) noexcept { _size += count; }
+    void sub_size(size_t count) noexcept { _size -= count; }
+    void set_size(size_t count) noexcept { _size = count; }
+    size_t tracked_size() const noexcept { return _size; }
+
+private:
+    size_t _size = 0;
+};
+
+} // namespace stlcontainer
@@ -0,0 +1,320 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+
+#include "IntrusiveForwardListIterator.h"
+
+namespace stlcontainer
+{
+
+// Singly linked list of caller-owned objects, linked through an IntrusiveForwardListHook member.
+// Nothing is allocated, copied or destroyed: the list only rewrites hooks, and the caller keeps the
+// objects alive while they are linked. Clearing or destroying the list just forgets the objects.
+//
+// A tail link makes push_back and splicing a whole list constant time.
+template<typename ListDataType, IntrusiveForwardListHook ListDataType::*Hook>
+class IntrusiveForwardList
+{
+// Type definitions
+private:
+    using hook_type = stlcontainer::IntrusiveForwardListHook;
+    using hook_pointer = stlcontainer::IntrusiveForwardListHook*;
+    using traits = stlcontainer::IntrusiveForwardListTraits<ListDataType, Hook>;
+
+public:
+    using value_type = ListDataType;
+    using reference = value_type&;
+    using const_reference = const reference;
+    using iterator = typename stlcontainer::IntrusiveForwardListIterator<ListDataType, Hook>;
+    using const_iterator = const iterator;
+
+public:
+    // Member Functions: Constructors
+    IntrusiveForwardList() noexcept : _before_head(), _tail(&_before_head) {};
+
+    IntrusiveForwardList(const IntrusiveForwardList& other) = delete;
+
+    IntrusiveForwardList(IntrusiveForwardList&& other) noexcept : IntrusiveForwardList()
+    {
+        swap(other);
+    }
+
+    // Member Functions: Destructor
+    ~IntrusiveForwardList() = default;
+
+    // Member Functions: Assignment Operator
+    IntrusiveForwardList& operator=(const IntrusiveForwardList& other) = delete;
+
+    IntrusiveForwardList& operator=(IntrusiveForwardList&& other) noexcept
+    {
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    // Member Functions: Element Access
+    reference front()
+    {
+        return *traits::to_value(_before_head._next);
+    }
+
+    const_reference front() const
+    {
+        return *traits::to_value(_before_head._next);
+    }
+
+    reference back()
+    {
+        return *traits::to_value(_tail);
+    }
+
+    const_reference back() const
+    {
+        return *traits::to_value(_tail);
+    }
+
+    // Member Functions: Iterators
+    iterator before_begin() noexcept
+    {
+        return iterator(&_before_head);
+    }
+
+    const_iterator before_begin() const noexcept
+    {
+        return iterator(const_cast<hook_pointer>(&_before_head));
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(_before_head._next);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return iterator(_before_head._next);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(nullptr);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return iterator(nullptr);
+    }
+
+    // Iterator to a linked object, constant time
+    static iterator iterator_to(reference value) noexcept
+    {
+        return iterator(traits::to_hook(value));
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _before_head._next == nullptr;
+    }
+
+    // Walks the list
+    size_t size() const noexcept
+    {
+        size_t count = 0;
+        for (auto curr_hook = _before_head._next; curr_hook; curr_hook = curr_hook->_next)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Member Functions: Modifiers
+    // Unlinks every object without touching them
+    void clear() noexcept
+    {
+        _before_head._next = nullptr;
+        _tail = &_before_head;
+    }
+
+    // value must not be linked through this hook already. Returns iterator to it.
+    iterator insert_after(const_iterator pos, reference value) noexcept
+    {
+        link_after(pos._pointee, traits::to_hook(value));
+        return iterator(traits::to_hook(value));
+    }
+
+    iterator erase_after(const_iterator pos) noexcept
+    {
+        auto hook_before = pos._pointee;
+        auto hook_to_erase = hook_before->_next;
+        hook_before->_next = hook_to_erase->_next;
+        if (hook_to_erase == _tail)
+        {
+            _tail = hook_before;
+        }
+        return iterator(hook_before->_next);
+    }
+
+    // Unlinks (first, last), constant time
+    iterator erase_after(const_iterator first, const_iterator last) noexcept
+    {
+        first._pointee->_next = last._pointee;
+        if (!last._pointee)
+        {
+            _tail = first._pointee;
+        }
+        return last;
+    }
+
+    void push_front(reference value) noexcept
+    {
+        link_after(&_before_head, traits::to_hook(value));
+    }
+
+    void push_back(reference value) noexcept
+    {
+        link_after(_tail, traits::to_hook(value));
+    }
+
+    void pop_front() noexcept
+    {
+        erase_after(before_begin());
+    }
+
+    void swap(IntrusiveForwardList& other) noexcept
+    {
+        using std::swap;
+        swap(_before_head._next, other._before_head._next);
+        swap(_tail, other._tail);
+
+        // An empty list's tail is its own sentinel
+        if (_tail == &other._before_head)
+        {
+            _tail = &_before_head;
+        }
+        if (other._tail == &_before_head)
+        {
+            other._tail = &other._before_head;
+        }
+    }
+
+    // Member Functions: Operations
+    // Relinks every object of other after pos, constant time
+    void splice_after(const_iterator pos, IntrusiveForwardList& other) noexcept
+    {
+        if (other.empty() || &other == this)
+        {
+            return;
+        }
+
+        auto hook_before = pos._pointee;
+        other._tail->_next = hook_before->_next;
+        hook_before->_next = other._before_head._next;
+        if (hook_before == _tail)
+        {
+            _tail = other._tail;
+        }
+        other.clear();
+    }
+
+    void splice_after(const_iterator pos, IntrusiveForwardList&& other) noexcept
+    {
+        splice_after(pos, other);
+    }
+
+    // Relinks the object after it (in other, which may be this list) after pos, constant time
+    void splice_after(const_iterator pos, IntrusiveForwardList& other, const_iterator it) noexcept
+    {
+        auto hook_before = it._pointee;
+        auto hook = hook_before->_next;
+        if (!hook || pos._pointee == hook_before || pos._pointee == hook)
+        {
+            return;
+        }
+
+        hook_before->_next = hook->_next;
+        if (hook == other._tail)
+        {
+            other._tail = hook_before;
+        }
+        link_after(pos._pointee, hook);
+    }
+
+    void splice_after(const_iterator pos, IntrusiveForwardList&& other, const_iterator it) noexcept
+    {
+        splice_after(pos, other, it);
+    }
+
+    // Relinks the objects in (first, last) after pos, linear in their number. pos must not be inside the range.
+    void splice_after(const_iterator pos, IntrusiveForwardList& other, const_iterator first, const_iterator last) noexcept
+    {
+        auto hook_before = first._pointee;
+        auto first_hook = hook_before->_next;
+        if (first_hook == last._pointee)
+        {
+            return;
+        }
+
+        auto last_hook = first_hook;
+        while (last_hook->_next != last._pointee)
+        {
+            last_hook = last_hook->_next;
+        }
+
+        hook_before->_next = last._pointee;
+        if (last_hook == other._tail)
+        {
+            other._tail = hook_before;
+        }
+
+        auto pos_hook = pos._pointee;
+        last_hook->_next = pos_hook->_next;
+        pos_hook->_next = first_hook;
+        if (pos_hook == _tail)
+        {
+            _tail = last_hook;
+        }
+    }
+
+    void splice_after(const_iterator pos, IntrusiveForwardList&& other, const_iterator first, const_iterator last) noexcept
+    {
+        splice_after(pos, other, first, last);
+    }
+
+    // Reverses link order in place
+    void reverse() noexcept
+    {
+        hook_pointer reversed = nullptr;
+        auto curr_hook = _before_head._next;
+        _tail = curr_hook ? curr_hook : &_before_head;
+        while (curr_hook)
+        {
+            auto next_hook = curr_hook->_next;
+            curr_hook->_next = reversed;
+            reversed = curr_hook;
+            curr_hook = next_hook;
+        }
+        _before_head._next = reversed;
+    }
+
+private:
+    hook_type _before_head;
+    hook_pointer _tail;         // Last hook, or &_before_head when empty
+
+    void link_after(hook_pointer hook_before, hook_pointer hook) noexcept
+    {
+        hook->_next = hook_before->_next;
+        hook_before->_next = hook;
+        if (hook_before == _tail)
+        {
+            _tail = hook;
+        }
+    }
+};
+
+template <class ListDataType, IntrusiveForwardListHook ListDataType::*Hook>
+void swap(IntrusiveForwardList<ListDataType, Hook>& lhs, IntrusiveForwardList<ListDataType, Hook>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+namespace stlcontainer
+{
+
+struct IntrusiveForwardListHook;
+template <typename T, IntrusiveForwardListHook T::*Hook> class IntrusiveForwardList;
+template <typename T, IntrusiveForwardListHook T::*Hook> class IntrusiveForwardListIterator;
+template <typename T, IntrusiveForwardListHook T::*Hook> struct IntrusiveForwardListTraits;
+
+// Link member for IntrusiveForwardList, embedded in the caller's type:
+//
+//     struct Task
+//     {
+//         int id;
+//         stlcontainer::IntrusiveForwardListHook hook;
+//     };
+//     stlcontainer::IntrusiveForwardList<Task, &Task::hook> tasks;
+//
+// An object can be in one list per hook. Copying an object does not copy its link.
+struct IntrusiveForwardListHook
+{
+// Friend declarations
+template <typename T, IntrusiveForwardListHook T::*Hook> friend class IntrusiveForwardList;
+template <typename T, IntrusiveForwardListHook T::*Hook> friend class IntrusiveForwardListIterator;
+
+public:
+    IntrusiveForwardListHook() noexcept : _next(nullptr) {};
+    IntrusiveForwardListHook(const IntrusiveForwardListHook&) noexcept : _next(nullptr) {};
+    IntrusiveForwardListHook& operator=(const IntrusiveForwardListHook&) noexcept { return *this; };
+
+private:
+    IntrusiveForwardListHook* _next;      // nullptr ends the list
+};
+
+// Conversions between an object and its hook
+template<typename T, IntrusiveForwardListHook T::*Hook>
+struct IntrusiveForwardListTraits
+{
+    static IntrusiveForwardListHook* to_hook(T& value) noexcept
+    {
+        return &(value.*Hook);
+    }
+
+    static T* to_value(IntrusiveForwardListHook* hook) noexcept
+    {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hook_offset());
+    }
+
+private:
+    // Member pointers carry no portable offset, measure it on a suitably aligned dummy address
+    static std::ptrdiff_t hook_offset() noexcept
+    {
+        static typename std::aligned_storage<sizeof(T), alignof(T)>::type probe;
+        auto object = reinterpret_cast<T*>(&probe);
+        return reinterpret_cast<char*>(&(object->*Hook)) - reinterpret_cast<char*>(object);
+    }
+};
+
+} // namespace stlcontainer
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include "IntrusiveForwardListHook.h"
+
+namespace stlcontainer
+{
+
+template<typename IterType, IntrusiveForwardListHook IterType::*Hook>
+class IntrusiveForwardListIterator : public std::iterator<
+    std::forward_iterator_tag,
+    IterType,
+    std::ptrdiff_t,
+    IterType*,
+    IterType&>
+{
+// Friend declarations
+friend class IntrusiveForwardList<IterType, Hook>;
+
+// Type definitions
+public:
+    using value_type =        IterType;
+    using reference =         IterType&;
+    using const_reference =   const reference;
+    using iterator =          typename stlcontainer::IntrusiveForwardListIterator<IterType, Hook>;
+    using const_iterator =    const iterator;
+
+public:
+
+    // Deference
+    reference operator* () const
+    {
+        return *IntrusiveForwardListTraits<IterType, Hook>::to_value(_pointee);
+    }
+
+    IterType* operator-> () const
+    {
+        return IntrusiveForwardListTraits<IterType, Hook>::to_value(_pointee);
+    }
+
+    // Increment/move
+    iterator& operator++()
+    {
+        _pointee = _pointee->_next;
+        return *this;
+    }
+
+    // Increment by value
+    iterator operator++(int)
+    {
+        iterator returnval(_pointee);
+        ++(*this);
+        return returnval;
+    }
+
+    // Comparison operator, equality
+    bool operator==(iterator other) const
+    {
+        return _pointee == other._pointee;
+    }
+
+    // Comparison operator, inequality
+    bool operator!=(iterator other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    stlcontainer::IntrusiveForwardListHook* _pointee;     // nullptr is end()
+    explicit IntrusiveForwardListIterator(stlcontainer::IntrusiveForwardListHook* pointee): _pointee(pointee) {};
+};
+
+} // namespace stlcontainer
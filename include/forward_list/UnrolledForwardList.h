@@ -0,0 +1,512 @@
+#pragma once
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "UnrolledForwardListIterator.h"
+
+namespace stlcontainer
+{
+
+// Singly linked list storing up to Capacity elements per node, so traversal touches one node (and
+// usually one cache miss) per Capacity elements instead of per element.
+//
+// insert_after shifts the elements behind the insertion point within their node and splits a full node
+// in two; erase_after shifts elements down and merges a node with its successor once both fit into one.
+// Unlike ForwardList, inserting or erasing invalidates iterators into the nodes it touches. erase_after
+// leaves pos valid. insert_after leaves pos valid unless it splits pos's node and pos lies in the upper
+// half, which moves to the new node: keep inserting through the returned iterator in that case.
+template<typename ListDataType, size_t Capacity = stlcontainer::UnrolledForwardListDefaultCapacity<ListDataType>::value>
+class UnrolledForwardList
+{
+// Type definitions
+private:
+    using unrolled_node = typename stlcontainer::UnrolledForwardListNode<ListDataType, Capacity>;
+    using node_pointer = typename stlcontainer::UnrolledForwardListNode<ListDataType, Capacity>*;
+    using node_base = typename stlcontainer::UnrolledForwardListNodeBase<ListDataType, Capacity>;
+    using node_base_pointer = typename stlcontainer::UnrolledForwardListNodeBase<ListDataType, Capacity>*;
+
+public:
+    using value_type = ListDataType;
+    using reference = value_type&;
+    using const_reference = const reference;
+    using iterator = typename stlcontainer::UnrolledForwardListIterator<ListDataType, Capacity>;
+    using const_iterator = const iterator;
+
+    static const size_t node_capacity = Capacity;
+
+    static_assert(Capacity >= 2, "A node must hold at least two elements to be split");
+
+public:
+    // Member Functions: Constructors
+    // Default constructor, allocates nothing until the first insert
+    explicit UnrolledForwardList() noexcept : _before_head(nullptr), _size(0) {};
+
+    // Fill constructor
+    UnrolledForwardList(size_t count, const ListDataType& value) : UnrolledForwardList()
+    {
+        node_base_pointer tail = &_before_head;
+        while (count--)
+        {
+            tail = append(tail, value);
+        }
+    }
+
+    // Copy constructor, packs every node full
+    UnrolledForwardList(const UnrolledForwardList& other) : UnrolledForwardList()
+    {
+        node_base_pointer tail = &_before_head;
+        for (const auto& elem : other)
+        {
+            tail = append(tail, elem);
+        }
+    }
+
+    // Move constructor
+    UnrolledForwardList(UnrolledForwardList&& other) noexcept : _before_head(other._before_head._next), _size(other._size)
+    {
+        other._before_head._next = nullptr;
+        other._size = 0;
+    }
+
+    // Initializer list constructor
+    UnrolledForwardList(std::initializer_list<ListDataType> initList) : UnrolledForwardList()
+    {
+        node_base_pointer tail = &_before_head;
+        for (const auto& elem : initList)
+        {
+            tail = append(tail, elem);
+        }
+    }
+
+    // Member Functions: Destructor
+    ~UnrolledForwardList()
+    {
+        clear();
+    }
+
+    // Member Functions: Assignment Operator
+    UnrolledForwardList& operator=(const UnrolledForwardList& other)
+    {
+        if (this != &other)
+        {
+            UnrolledForwardList copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    UnrolledForwardList& operator=(UnrolledForwardList&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    UnrolledForwardList& operator=(std::initializer_list<ListDataType> initList)
+    {
+        UnrolledForwardList copy(initList);
+        swap(copy);
+        return *this;
+    }
+
+    // Member Functions: Element Access
+    reference front()
+    {
+        return unrolled_node::from_base(_before_head._next)->data()[0];
+    }
+
+    const_reference front() const
+    {
+        return unrolled_node::from_base(_before_head._next)->data()[0];
+    }
+
+    // Member Functions: Iterators
+    iterator before_begin() noexcept
+    {
+        return iterator(&_before_head);
+    }
+
+    const_iterator before_begin() const noexcept
+    {
+        return iterator(const_cast<node_base_pointer>(&_before_head));
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(_before_head._next);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return iterator(_before_head._next);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(nullptr);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return iterator(nullptr);
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _before_head._next == nullptr;
+    }
+
+    size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    // Number of allocated nodes, size() / node_count() is the average fill
+    size_t node_count() const noexcept
+    {
+        size_t count = 0;
+        for (auto curr_node = _before_head._next; curr_node; curr_node = curr_node->_next)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Member Functions: Modifiers
+    void clear() noexcept
+    {
+        auto curr_node = _before_head._next;
+        while (curr_node)
+        {
+            auto next_node = curr_node->_next;
+            destroy_elements(curr_node, 0, curr_node->_count);
+            delete unrolled_node::from_base(curr_node);
+            curr_node = next_node;
+        }
+        _before_head._next = nullptr;
+        _size = 0;
+    }
+
+    iterator insert_after(const_iterator pos, const ListDataType& value)
+    {
+        return emplace_after(pos, value);
+    }
+
+    iterator insert_after(const_iterator pos, ListDataType&& value)
+    {
+        return emplace_after(pos, std::move(value));
+    }
+
+    // Returns iterator to the new element. A split invalidates pos when pos lies in the half that moves.
+    template<typename... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args)
+    {
+        if (pos._node == &_before_head)
+        {
+            return emplace_front_node(std::forward<Args>(args)...);
+        }
+        return emplace_at(pos._node, pos._index + 1, std::forward<Args>(args)...);
+    }
+
+    // Returns iterator to the element following the erased one
+    iterator erase_after(const_iterator pos)
+    {
+        erase_elements(pos, 1);
+        return rebalance_after(pos);
+    }
+
+    iterator erase_after(const_iterator first, const_iterator last)
+    {
+        size_t count = 0;
+        for (auto iter = std::next(first); iter != last; ++iter)
+        {
+            ++count;
+        }
+        erase_elements(first, count);
+        return rebalance_after(first);
+    }
+
+    void push_front(const ListDataType& value)
+    {
+        emplace_front_node(value);
+    }
+
+    void push_front(ListDataType&& value)
+    {
+        emplace_front_node(std::move(value));
+    }
+
+    template<typename... Args>
+    reference emplace_front(Args&&... args)
+    {
+        return *emplace_front_node(std::forward<Args>(args)...);
+    }
+
+    void pop_front()
+    {
+        erase_after(before_begin());
+    }
+
+    void swap(UnrolledForwardList& other) noexcept
+    {
+        using std::swap;
+        swap(_before_head._next, other._before_head._next);
+        swap(_size, other._size);
+    }
+
+private:
+    node_base _before_head;
+    size_t _size;
+
+    static value_type* values(node_base_pointer node) noexcept
+    {
+        return unrolled_node::from_base(node)->data();
+    }
+
+    static void destroy_elements(node_base_pointer node, size_t first, size_t last) noexcept
+    {
+        if (!std::is_trivially_destructible<value_type>::value)
+        {
+            auto elements = values(node);
+            for (auto index = first; index < last; ++index)
+            {
+                elements[index].~value_type();
+            }
+        }
+    }
+
+    // New empty node linked after node_before
+    static node_base_pointer link_node(node_base_pointer node_before)
+    {
+        auto node = new unrolled_node(node_before->_next);
+        node_before->_next = node;
+        return node;
+    }
+
+    static void unlink_node(node_base_pointer node_before) noexcept
+    {
+        auto node = node_before->_next;
+        node_before->_next = node->_next;
+        delete unrolled_node::from_base(node);
+    }
+
+    // Appends after the last element of tail (the sentinel if the list is empty), returns the new tail
+    template<typename Arg>
+    node_base_pointer append(node_base_pointer tail, Arg&& arg)
+    {
+        if (tail == &_before_head || tail->_count == Capacity)
+        {
+            tail = link_node(tail);
+        }
+        try
+        {
+            ::new (values(tail) + tail->_count) value_type(std::forward<Arg>(arg));
+        }
+        catch (...)
+        {
+            if (tail->_count == 0)
+            {
+                unlink_tail(tail);
+            }
+            throw;
+        }
+        ++tail->_count;
+        ++_size;
+        return tail;
+    }
+
+    // Drops an empty last node after a failed append
+    void unlink_tail(node_base_pointer tail) noexcept
+    {
+        node_base_pointer node_before = &_before_head;
+        while (node_before->_next != tail)
+        {
+            node_before = node_before->_next;
+        }
+        unlink_node(node_before);
+    }
+
+    template<typename... Args>
+    iterator emplace_front_node(Args&&... args)
+    {
+        if (!_before_head._next)
+        {
+            return emplace_in_new_node(&_before_head, std::forward<Args>(args)...);
+        }
+        return emplace_at(_before_head._next, 0, std::forward<Args>(args)...);
+    }
+
+    // New element alone in a new node after node_before
+    template<typename... Args>
+    iterator emplace_in_new_node(node_base_pointer node_before, Args&&... args)
+    {
+        auto node = link_node(node_before);
+        try
+        {
+            ::new (values(node)) value_type(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            unlink_node(node_before);
+            throw;
+        }
+        node->_count = 1;
+        ++_size;
+        return iterator(node, 0);
+    }
+
+    // New element at position index of node, 0 <= index <= node->_count
+    template<typename... Args>
+    iterator emplace_at(node_base_pointer node, size_t index, Args&&... args)
+    {
+        if (node->_count == Capacity)
+        {
+            // Appending behind a full node starts a new one, so in-order inserts leave full nodes behind
+            if (index == Capacity)
+            {
+                return emplace_in_new_node(node, std::forward<Args>(args)...);
+            }
+
+            split(node);
+            if (index > node->_count)
+            {
+                index -= node->_count;
+                node = node->_next;
+            }
+        }
+
+        auto elements = values(node);
+        auto count = node->_count;
+        if (index == count)
+        {
+            ::new (elements + count) value_type(std::forward<Args>(args)...);
+        }
+        else
+        {
+            // Built before shifting, args may refer to an element of this node
+            value_type value(std::forward<Args>(args)...);
+            ::new (elements + count) value_type(std::move(elements[count - 1]));
+            std::move_backward(elements + index, elements + count - 1, elements + count);
+            elements[index] = std::move(value);
+        }
+        ++node->_count;
+        ++_size;
+        return iterator(node, index);
+    }
+
+    // Moves the upper half of a full node into a new node after it
+    void split(node_base_pointer node)
+    {
+        auto new_node = link_node(node);
+        auto half = node->_count / 2;
+        auto elements = values(node);
+        try
+        {
+            std::uninitialized_copy(std::make_move_iterator(elements + half),
+                std::make_move_iterator(elements + node->_count), values(new_node));
+        }
+        catch (...)
+        {
+            unlink_node(node);
+            throw;
+        }
+        destroy_elements(node, half, node->_count);
+        new_node->_count = node->_count - half;
+        node->_count = half;
+    }
+
+    // Erases count elements following pos, whole nodes at a time where possible
+    void erase_elements(const_iterator pos, size_t count)
+    {
+        node_base_pointer node_before = pos._node;
+        node_base_pointer node = pos._node;
+        size_t index = pos._index + 1;
+        if (index >= node->_count)
+        {
+            node = node->_next;
+            index = 0;
+        }
+
+        while (count)
+        {
+            auto erase_count = std::min(count, node->_count - index);
+            auto elements = values(node);
+            auto new_end = std::move(elements + index + erase_count, elements + node->_count, elements + index);
+            destroy_elements(node, new_end - elements, node->_count);
+            node->_count -= erase_count;
+            _size -= erase_count;
+            count -= erase_count;
+
+            // Only a node erased from its first element can empty, pos is then in the node before it
+            if (node->_count == 0)
+            {
+                unlink_node(node_before);
+                node = node_before->_next;
+            }
+            else
+            {
+                node_before = node;
+                node = node->_next;
+            }
+            index = 0;
+        }
+    }
+
+    // After an erase behind pos, merges pos's node and the node after it with their successors where they
+    // fit into one node. pos's node is only ever the surviving side, so pos stays valid.
+    iterator rebalance_after(const_iterator pos) noexcept
+    {
+        if (pos._node != &_before_head)
+        {
+            merge_next(pos._node);
+        }
+        if (pos._node->_next)
+        {
+            merge_next(pos._node->_next);
+        }
+
+        auto iter = pos;
+        return ++iter;
+    }
+
+    void merge_next(node_base_pointer node) noexcept
+    {
+        auto next_node = node->_next;
+        if (!next_node || node->_count + next_node->_count > Capacity)
+        {
+            return;
+        }
+
+        // Moves into raw storage cannot be undone halfway, so only nothrow-movable elements are merged
+        if (!std::is_nothrow_move_constructible<value_type>::value)
+        {
+            return;
+        }
+        auto elements = values(next_node);
+        auto target = values(node) + node->_count;
+        for (size_t index = 0; index < next_node->_count; ++index)
+        {
+            ::new (target + index) value_type(std::move(elements[index]));
+        }
+        destroy_elements(next_node, 0, next_node->_count);
+        node->_count += next_node->_count;
+        next_node->_count = 0;
+        unlink_node(node);
+    }
+};
+
+template<typename ListDataType, size_t Capacity>
+const size_t UnrolledForwardList<ListDataType, Capacity>::node_capacity;
+
+template <class ListDataType, size_t Capacity>
+void swap(UnrolledForwardList<ListDataType, Capacity>& lhs, UnrolledForwardList<ListDataType, Capacity>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include "UnrolledForwardListNode.h"
+
+namespace stlcontainer
+{
+
+template<typename IterType, size_t Capacity>
+class UnrolledForwardListIterator : public std::iterator<
+    std::forward_iterator_tag,
+    IterType,
+    std::ptrdiff_t,
+    IterType*,
+    IterType&>
+{
+// Friend declarations
+friend class UnrolledForwardList<IterType, Capacity>;
+
+// Type definitions
+public:
+    using value_type =        IterType;
+    using reference =         IterType&;
+    using const_reference =   const reference;
+    using iterator =          typename stlcontainer::UnrolledForwardListIterator<IterType, Capacity>;
+    using const_iterator =    const iterator;
+
+public:
+
+    // Deference
+    reference operator* () const
+    {
+        return UnrolledForwardListNode<IterType, Capacity>::from_base(_node)->data()[_index];
+    }
+
+    // Increment/move, steps to the next node after the last element of this one.
+    // The sentinel holds no elements, so before_begin() steps straight to the first node.
+    iterator& operator++()
+    {
+        if (++_index >= _node->_count)
+        {
+            _node = _node->_next;
+            _index = 0;
+        }
+        return *this;
+    }
+
+    // Increment by value
+    iterator operator++(int)
+    {
+        iterator returnval(_node, _index);
+        ++(*this);
+        return returnval;
+    }
+
+    // Comparison operator, equality
+    bool operator==(iterator other) const
+    {
+        return _node == other._node && _index == other._index;
+    }
+
+    // Comparison operator, inequality
+    bool operator!=(iterator other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    stlcontainer::UnrolledForwardListNodeBase<IterType, Capacity>* _node;     // nullptr is end()
+    size_t _index;
+    explicit UnrolledForwardListIterator(stlcontainer::UnrolledForwardListNodeBase<IterType, Capacity>* node, size_t index = 0)
+        : _node(node), _index(index) {};
+};
+
+} // namespace stlcontainer
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+namespace stlcontainer
+{
+
+template <typename T, size_t Capacity> class UnrolledForwardList;
+template <typename T, size_t Capacity> class UnrolledForwardListIterator;
+template <typename T, size_t Capacity> class UnrolledForwardListNode;
+
+// Default elements per node: about 512 bytes of values, and never fewer than 4
+template<typename T>
+struct UnrolledForwardListDefaultCapacity
+{
+    static const size_t value = (sizeof(T) * 4 > 512) ? 4 : 512 / sizeof(T);
+};
+
+template<typename T>
+const size_t UnrolledForwardListDefaultCapacity<T>::value;
+
+// Link part of a node. UnrolledForwardList embeds one holding no elements as its before-head sentinel.
+// A nullptr link marks the end of the list.
+template<typename NodeType, size_t Capacity>
+class UnrolledForwardListNodeBase
+{
+// Friend declarations
+friend class UnrolledForwardListIterator<NodeType, Capacity>;
+friend class UnrolledForwardList<NodeType, Capacity>;
+friend class UnrolledForwardListNode<NodeType, Capacity>;
+
+private:
+    stlcontainer::UnrolledForwardListNodeBase<NodeType, Capacity>* _next;
+    size_t _count;      // Elements in use, never 0 for a node linked into a list
+
+    // Constructor and destructor
+    explicit UnrolledForwardListNodeBase(stlcontainer::UnrolledForwardListNodeBase<NodeType, Capacity>* next = nullptr)
+        : _next(next), _count(0) {};
+    ~UnrolledForwardListNodeBase() = default;
+};
+
+// Up to Capacity elements stored back to back in [0, _count). The storage is raw: the list constructs and
+// destroys elements itself as it shifts them around.
+template<typename NodeType, size_t Capacity>
+class UnrolledForwardListNode : public UnrolledForwardListNodeBase<NodeType, Capacity>
+{
+// Friend declarations
+friend class UnrolledForwardListIterator<NodeType, Capacity>;
+friend class UnrolledForwardList<NodeType, Capacity>;
+
+// Type definitions
+public:
+    using value_type = NodeType;
+    using reference = value_type&;
+    using const_reference = const reference;
+
+private:
+    typename std::aligned_storage<sizeof(NodeType), alignof(NodeType)>::type _storage[Capacity];
+
+    static_assert(alignof(NodeType) <= alignof(std::max_align_t), "Over-aligned elements are not supported");
+
+    // Constructor and destructor, elements must already be destroyed
+    explicit UnrolledForwardListNode(stlcontainer::UnrolledForwardListNodeBase<NodeType, Capacity>* next = nullptr)
+        : UnrolledForwardListNodeBase<NodeType, Capacity>(next) {};
+    ~UnrolledForwardListNode() = default;
+
+    value_type* data() noexcept
+    {
+        return reinterpret_cast<value_type*>(_storage);
+    }
+
+    static UnrolledForwardListNode* from_base(UnrolledForwardListNodeBase<NodeType, Capacity>* base) noexcept
+    {
+        return static_cast<UnrolledForwardListNode*>(base);
+    }
+};
+
+} // namespace stlcontainer
@@ -0,0 +1,299 @@
+#pragma once
+#include "stddef.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <optional>
+#endif
+
+namespace stlcontainer
+{
+
+// Outcome of a pop that may give up: it got an element, ran out of time, or found the queue closed and drained
+enum class queue_op_status
+{
+    success,
+    timeout,
+    closed
+};
+
+// Unbounded FIFO for consumers that wait for work instead of polling for it.
+//
+// Consumers sleep on a condition variable, which producers only signal while someone actually waits, so a
+// push into a queue nobody waits on costs one uncontended lock. close() ends the stream: later pushes fail,
+// consumers still receive everything queued before it, and once the queue is empty every pop returns false
+// or queue_op_status::closed instead of waiting.
+//
+// With C++20 coroutines, async_pop() suspends the calling coroutine instead of blocking its thread. A push
+// hands its element straight to the oldest suspended coroutine and resumes it on the pushing thread, after
+// releasing the lock. A coroutine suspended in async_pop must not be destroyed before it is resumed.
+template<typename QueueDataType, typename Container = std::deque<QueueDataType>>
+class BlockingQueue
+{
+public:
+    // Type definitions
+    using container_type =  Container;
+    using value_type =      typename Container::value_type;
+    using size_type =       typename Container::size_type;
+
+public:
+    // Member Functions: Constructors
+    BlockingQueue() = default;
+    BlockingQueue(const BlockingQueue& other) = delete;
+    BlockingQueue& operator=(const BlockingQueue& other) = delete;
+
+    // Member Functions: Capacity
+    // Snapshots, stale as soon as the lock is released
+    size_type size() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _container.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    bool is_closed() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _closed;
+    }
+
+    // Member Functions: Producers
+    // Each returns false, and leaves the argument untouched, once the queue is closed
+    bool push(const value_type& value)
+    {
+        return emplace(value);
+    }
+
+    bool push(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    bool emplace(Args&&... args)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_closed)
+        {
+            return false;
+        }
+        if (_suspended_head != nullptr)
+        {
+            // Built before the waiter is dequeued, so a throwing constructor leaves it waiting
+            value_type value(std::forward<Args>(args)...);
+            auto waiter = _suspended_head;
+            _suspended_head = waiter->_next;
+            if (_suspended_head == nullptr)
+            {
+                _suspended_tail = nullptr;
+            }
+            lock.unlock();
+            waiter->_deliver(*waiter, &value);
+            return true;
+        }
+        _container.emplace_back(std::forward<Args>(args)...);
+        auto wake = _waiting != 0;
+        lock.unlock();
+        if (wake)
+        {
+            _not_empty.notify_one();
+        }
+        return true;
+    }
+
+    // Refuses further pushes and wakes every waiting consumer. Elements already queued can still be popped.
+    void close()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _closed = true;
+        auto waiter = _suspended_head;
+        _suspended_head = nullptr;
+        _suspended_tail = nullptr;
+        lock.unlock();
+        _not_empty.notify_all();
+        while (waiter != nullptr)
+        {
+            auto next = waiter->_next;
+            waiter->_deliver(*waiter, nullptr);
+            waiter = next;
+        }
+    }
+
+    // Member Functions: Consumers
+    // Moves the oldest element into value, false when the queue is empty
+    bool try_pop(value_type& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return take(value);
+    }
+
+    // Waits for an element, false only once the queue is closed and empty
+    bool pop(value_type& value)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!ready())
+        {
+            ++_waiting;
+            _not_empty.wait(lock, [this] { return ready(); });
+            --_waiting;
+        }
+        return take(value);
+    }
+
+    template<typename Rep, typename Period>
+    queue_op_status pop_for(value_type& value, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return pop_until(value, std::chrono::steady_clock::now() + timeout);
+    }
+
+    template<typename Clock, typename Duration>
+    queue_op_status pop_until(value_type& value, const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!ready())
+        {
+            ++_waiting;
+            _not_empty.wait_until(lock, deadline, [this] { return ready(); });
+            --_waiting;
+        }
+        if (take(value))
+        {
+            return queue_op_status::success;
+        }
+        return _closed ? queue_op_status::closed : queue_op_status::timeout;
+    }
+
+    // Moves every queued element to out under one lock, without waiting. Returns how many.
+    template<typename OutputIterator>
+    size_type drain(OutputIterator out)
+    {
+        Container taken;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            taken.swap(_container);
+        }
+        for (auto& value : taken)
+        {
+            *out = std::move(value);
+            ++out;
+        }
+        return taken.size();
+    }
+
+#if defined(__cpp_impl_coroutine)
+    class pop_awaiter;
+
+    // co_await queue.async_pop() yields std::optional<value_type>, empty once the queue is closed and drained
+    pop_awaiter async_pop() noexcept
+    {
+        return pop_awaiter(*this);
+    }
+#endif
+
+private:
+    // A suspended async_pop, queued until a push or close delivers to it. Declared without coroutine types
+    // so the layout of the queue does not depend on the language version a translation unit is built with.
+    struct suspended_pop
+    {
+        suspended_pop* _next = nullptr;
+        void (*_deliver)(suspended_pop& self, value_type* value) = nullptr;    // nullptr value: closed
+    };
+
+    mutable std::mutex _mutex;
+    std::condition_variable _not_empty;
+    Container _container;
+    size_type _waiting = 0;                         // Threads asleep in pop, pop_for and pop_until
+    bool _closed = false;
+    suspended_pop* _suspended_head = nullptr;       // Oldest suspended async_pop, only while the queue is empty
+    suspended_pop* _suspended_tail = nullptr;
+
+    bool ready() const noexcept
+    {
+        return !_container.empty() || _closed;
+    }
+
+    bool take(value_type& value)
+    {
+        if (_container.empty())
+        {
+            return false;
+        }
+        value = std::move(_container.front());
+        _container.pop_front();
+        return true;
+    }
+};
+
+#if defined(__cpp_impl_coroutine)
+template<typename QueueDataType, typename Container>
+class BlockingQueue<QueueDataType, Container>::pop_awaiter : private BlockingQueue<QueueDataType, Container>::suspended_pop
+{
+public:
+    explicit pop_awaiter(BlockingQueue& queue) noexcept : _queue(queue) {}
+
+    // Everything happens in await_suspend, under one lock
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    // Returns false, resuming at once, when an element is queued or the queue is closed
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        std::lock_guard<std::mutex> lock(_queue._mutex);
+        if (_queue.ready())
+        {
+            if (!_queue._container.empty())
+            {
+                _value.emplace(std::move(_queue._container.front()));
+                _queue._container.pop_front();
+            }
+            return false;
+        }
+        _handle = handle;
+        this->_deliver = &pop_awaiter::deliver;
+        if (_queue._suspended_tail != nullptr)
+        {
+            _queue._suspended_tail->_next = this;
+        }
+        else
+        {
+            _queue._suspended_head = this;
+        }
+        _queue._suspended_tail = this;
+        return true;
+    }
+
+    std::optional<value_type> await_resume()
+    {
+        return std::move(_value);
+    }
+
+private:
+    BlockingQueue& _queue;
+    std::coroutine_handle<> _handle;
+    std::optional<value_type> _value;
+
+    static void deliver(suspended_pop& self, value_type* value)
+    {
+        auto& awaiter = static_cast<pop_awaiter&>(self);
+        if (value != nullptr)
+        {
+            awaiter._value.emplace(std::move(*value));
+        }
+        awaiter._handle.resume();
+    }
+};
+#endif
+
+} // namespace stlcontainer
@@ -0,0 +1,11 @@
+#pragma once
+#include "stddef.h"
+
+namespace stlcontainer
+{
+
+// Bytes that data written by different threads is kept apart by, so one thread's writes do not invalidate
+// the cache line another thread is reading (false sharing). 64 on x86-64 and most ARM cores.
+const size_t CACHE_LINE_SIZE = 64;
+
+} // namespace stlcontainer
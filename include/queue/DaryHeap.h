@@ -0,0 +1,172 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace stlcontainer
+{
+
+// Heap algorithms over a random-access range where every node has Arity children, stored level by level:
+// the children of index i are Arity * i + 1 ... Arity * i + Arity.
+//
+// A wider node makes the tree shallower, so sift_up does log_Arity(n) steps instead of log2(n), and the
+// Arity children that sift_down compares sit next to each other in memory, usually in one or two cache
+// lines. before(a, b) is true when a belongs above b. Sifts move a hole rather than swapping, and call
+// on_move(index) after each element lands at index so callers can track positions. Elements are reached as
+// *(first + index), so iterators without operator[] work too.
+template<size_t Arity>
+struct DaryHeap
+{
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+
+    static size_t parent(size_t index) noexcept
+    {
+        return (index - 1) / Arity;
+    }
+
+    static size_t first_child(size_t index) noexcept
+    {
+        return index * Arity + 1;
+    }
+
+    // Moves the element at hole towards the root until its parent belongs above it. Returns where it landed.
+    template<typename RandomIterator, typename Before, typename OnMove>
+    static size_t sift_up(RandomIterator first, size_t hole, Before&& before, OnMove&& on_move)
+    {
+        auto value = std::move(at(first, hole));
+        while (hole > 0)
+        {
+            auto up = parent(hole);
+            if (!before(value, at(first, up)))
+            {
+                break;
+            }
+            at(first, hole) = std::move(at(first, up));
+            on_move(hole);
+            hole = up;
+        }
+        at(first, hole) = std::move(value);
+        on_move(hole);
+        return hole;
+    }
+
+    // Moves the element at hole towards the leaves of [first, first + size) until no child belongs above it
+    template<typename RandomIterator, typename Before, typename OnMove>
+    static size_t sift_down(RandomIterator first, size_t size, size_t hole, Before&& before, OnMove&& on_move)
+    {
+        auto value = std::move(at(first, hole));
+        while (true)
+        {
+            auto child = first_child(hole);
+            if (child >= size)
+            {
+                break;
+            }
+            auto best = best_child(first, size, child, before);
+            if (!before(at(first, best), value))
+            {
+                break;
+            }
+            at(first, hole) = std::move(at(first, best));
+            on_move(hole);
+            hole = best;
+        }
+        at(first, hole) = std::move(value);
+        on_move(hole);
+        return hole;
+    }
+
+    // Removes the root of [first, first + size): its slot becomes a hole that follows the best child down to
+    // a leaf, and the last element fills that leaf and sifts up. An element taken from the bottom usually
+    // belongs near the bottom, so this skips the comparison against it on every level that sift_down would
+    // make. The range shrinks to size - 1, and the old root is moved into the slot just past it, first + size - 1.
+    template<typename RandomIterator, typename Before, typename OnMove>
+    static void pop(RandomIterator first, size_t size, Before&& before, OnMove&& on_move)
+    {
+        auto last = size - 1;
+        if (last == 0)
+        {
+            return;
+        }
+        auto value = std::move(at(first, last));
+        at(first, last) = std::move(at(first, 0));
+        size_t hole = 0;
+        while (true)
+        {
+            auto child = first_child(hole);
+            if (child >= last)
+            {
+                break;
+            }
+            auto best = best_child(first, last, child, before);
+            at(first, hole) = std::move(at(first, best));
+            on_move(hole);
+            hole = best;
+        }
+        at(first, hole) = std::move(value);
+        sift_up(first, hole, before, on_move);
+    }
+
+    // Floyd's bottom-up construction: sifts every internal node down, last first. O(size).
+    template<typename RandomIterator, typename Before, typename OnMove>
+    static void make_heap(RandomIterator first, size_t size, Before&& before, OnMove&& on_move)
+    {
+        for (size_t index = 0; index < size; ++index)
+        {
+            on_move(index);
+        }
+        if (size < 2)
+        {
+            return;
+        }
+        for (auto index = parent(size - 1) + 1; index-- > 0;)
+        {
+            sift_down(first, size, index, before, on_move);
+        }
+    }
+
+    // Places the element at index where it belongs after its key changed in either direction
+    template<typename RandomIterator, typename Before, typename OnMove>
+    static size_t update(RandomIterator first, size_t size, size_t index, Before&& before, OnMove&& on_move)
+    {
+        if (index > 0 && before(at(first, index), at(first, parent(index))))
+        {
+            return sift_up(first, index, before, on_move);
+        }
+        return sift_down(first, size, index, before, on_move);
+    }
+
+private:
+    template<typename RandomIterator>
+    static auto at(RandomIterator first, size_t index) -> decltype(*first)
+    {
+        return *(first + index);
+    }
+
+    // Index of the highest-priority child among those starting at child. Nodes with all Arity children take
+    // a fixed-count loop the compiler can unroll.
+    template<typename RandomIterator, typename Before>
+    static size_t best_child(RandomIterator first, size_t size, size_t child, Before& before)
+    {
+        auto best = child;
+        if (child + Arity <= size)
+        {
+            for (size_t offset = 1; offset < Arity; ++offset)
+            {
+                best = before(at(first, child + offset), at(first, best)) ? child + offset : best;
+            }
+        }
+        else
+        {
+            for (++child; child < size; ++child)
+            {
+                best = before(at(first, child), at(first, best)) ? child : best;
+            }
+        }
+        return best;
+    }
+};
+
+} // namespace stlcontainer
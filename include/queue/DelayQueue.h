@@ -0,0 +1,414 @@
+#pragma once
+#include "stddef.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stlcontainer
+{
+
+// Holds values until a deadline, as a hierarchical timing wheel: schedule and cancel are O(1), and advance
+// hands expired values over in deadline order.
+//
+// Time is counted in ticks of a fixed duration since the start time point. The wheel has LEVELS levels of
+// SLOTS slots; a level-L slot spans SLOTS^L ticks. An entry goes to the lowest level at which its deadline
+// still differs from the current tick, in the slot given by its deadline's digits there. When the current
+// tick reaches a slot boundary the entries of that higher-level slot are re-filed one level further down
+// (a cascade), and level-0 slots hold only entries due at exactly that tick. Each level keeps a bitmap of
+// occupied slots, so advance jumps straight to the next tick where something happens instead of visiting
+// every tick. Deadlines past the top level wait in an overflow bucket that is re-filed each time the top
+// level wraps.
+//
+// Values sit in a chunked node pool that never moves them. A slot is a vector of small (deadline, node,
+// generation) records, so cascading reads and writes contiguous memory and only reads each node's
+// generation. cancel destroys the value and bumps the node's generation in O(1), and the stale record is
+// dropped at the next cascade or when its slot comes due. The clock is a template parameter with the std::chrono
+// clock interface and every call that needs the time also takes it explicitly, so tests can drive the
+// queue with a fake clock. Not thread-safe.
+template<typename DelayQueueDataType, typename Clock = std::chrono::steady_clock>
+class DelayQueue
+{
+public:
+    // Type definitions
+    using value_type =      DelayQueueDataType;
+    using size_type =       size_t;
+    using clock_type =      Clock;
+    using time_point =      typename Clock::time_point;
+    using duration =        typename Clock::duration;
+
+    // Names a scheduled entry for cancel. Stays unique after the entry fires or is cancelled.
+    struct handle_type
+    {
+        uint32_t _index;
+        uint32_t _generation;
+    };
+
+    static const size_t SLOT_BITS = 6;
+    static const size_t SLOTS = size_t(1) << SLOT_BITS;
+    static const size_t LEVELS = 6;
+
+public:
+    // Member Functions: Constructors
+    // Tick zero is start; deadlines are rounded up to whole ticks, so nothing fires early
+    explicit DelayQueue(duration tick = std::chrono::milliseconds(1), time_point start = Clock::now())
+        : _tick(tick), _start(start)
+    {
+    }
+
+    DelayQueue(const DelayQueue& other) = delete;
+    DelayQueue& operator=(const DelayQueue& other) = delete;
+
+    // Member Functions: Destructor
+    ~DelayQueue()
+    {
+        for (uint32_t index = 0; index < _allocated; ++index)
+        {
+            auto& entry = node(index);
+            if (entry._scheduled)
+            {
+                entry.value().~value_type();
+            }
+        }
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    // Entries scheduled and neither fired nor cancelled
+    size_type size() const noexcept
+    {
+        return _size;
+    }
+
+    // Member Functions: Time
+    // The time advance last moved the wheel to
+    time_point now() const
+    {
+        return _start + _tick * static_cast<typename duration::rep>(_now);
+    }
+
+    duration tick() const noexcept
+    {
+        return _tick;
+    }
+
+    // Member Functions: Modifiers
+    // A deadline at or before now() fires on the next advance
+    template<typename... Args>
+    handle_type schedule(time_point deadline, Args&&... args)
+    {
+        auto index = allocate();
+        auto& entry = node(index);
+        try
+        {
+            new (&entry._storage) value_type(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            release(index);
+            throw;
+        }
+        try
+        {
+            file(slot_record{deadline_tick(deadline), index, entry._generation});
+        }
+        catch (...)
+        {
+            entry.value().~value_type();
+            release(index);
+            throw;
+        }
+        entry._scheduled = true;
+        ++_size;
+        return handle_type{index, entry._generation};
+    }
+
+    template<typename... Args>
+    handle_type schedule_after(duration delay, Args&&... args)
+    {
+        return schedule(now() + delay, std::forward<Args>(args)...);
+    }
+
+    // Destroys the entry's value without firing it. False if it already fired or was cancelled.
+    bool cancel(handle_type handle)
+    {
+        if (handle._index >= _allocated || !live(slot_record{0, handle._index, handle._generation}))
+        {
+            return false;
+        }
+        node(handle._index).value().~value_type();
+        release(handle._index);
+        --_size;
+        return true;
+    }
+
+    // Moves the wheel to time and calls on_expired(value_type&&) for every entry due by then, earliest
+    // deadline first. Entries due in the same tick fire in no set order. on_expired may schedule or cancel;
+    // entries it schedules at or before time fire in this same call. Returns how many fired. Moving
+    // backwards in time fires nothing.
+    template<typename Function>
+    size_type advance(time_point time, Function&& on_expired)
+    {
+        auto target = elapsed_ticks(time);
+        auto fired = fire(DUE_BUCKET, on_expired);
+        uint64_t tick = 0;
+        while (next_event(tick) && tick <= target)
+        {
+            _now = tick;
+            cascade(tick);
+            fired += fire(bucket_of(0, tick), on_expired);
+            fired += fire(DUE_BUCKET, on_expired);
+        }
+        _now = target > _now ? target : _now;
+        return fired;
+    }
+
+    // Advances to Clock::now()
+    template<typename Function>
+    size_type advance(Function&& on_expired)
+    {
+        return advance(Clock::now(), std::forward<Function>(on_expired));
+    }
+
+private:
+    static const uint32_t NIL = UINT32_MAX;
+    static const uint32_t CHUNK_BITS = 10;
+    static const uint32_t CHUNK_SIZE = uint32_t(1) << CHUNK_BITS;
+
+    // Bucket ids: LEVELS * SLOTS wheel slots, then these
+    static const uint32_t DUE_BUCKET = LEVELS * SLOTS;         // Expired, fires at the next chance
+    static const uint32_t BEYOND_WHEEL = DUE_BUCKET + 1;       // Past the top level
+    static const uint32_t BUCKET_COUNT = BEYOND_WHEEL + 1;
+
+    struct entry_node
+    {
+        typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type _storage;
+        uint32_t _generation;
+        uint32_t _next_free;
+        bool _scheduled;
+
+        value_type& value() noexcept
+        {
+            return *reinterpret_cast<value_type*>(&_storage);
+        }
+    };
+
+    // What a slot holds for each entry; stale once the node's generation moves on
+    struct slot_record
+    {
+        uint64_t _deadline;         // In ticks since _start
+        uint32_t _index;
+        uint32_t _generation;
+    };
+
+    duration _tick;
+    time_point _start;
+    uint64_t _now = 0;                                      // Current tick
+    size_type _size = 0;
+    std::vector<slot_record> _buckets[BUCKET_COUNT];
+    std::vector<slot_record> _firing;                       // A bucket being fired or re-filed, reused
+    uint64_t _occupied[LEVELS] = {};                        // Bit s of level L set when its slot s is non-empty
+    std::vector<std::unique_ptr<entry_node[]>> _chunks;
+    uint32_t _allocated = 0;                                // Nodes handed out from the chunks so far
+    uint32_t _free = NIL;                                   // Free nodes, linked through _next_free
+
+    static_assert(SLOTS == 64, "the occupancy bitmaps are one uint64_t per level");
+
+    entry_node& node(uint32_t index) const noexcept
+    {
+        return _chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)];
+    }
+
+    bool live(const slot_record& record) const noexcept
+    {
+        auto& entry = node(record._index);
+        return entry._scheduled && entry._generation == record._generation;
+    }
+
+    static uint32_t bucket_of(size_t level, uint64_t tick) noexcept
+    {
+        return static_cast<uint32_t>(level * SLOTS + ((tick >> (level * SLOT_BITS)) & (SLOTS - 1)));
+    }
+
+    uint64_t elapsed_ticks(time_point time) const
+    {
+        return time <= _start ? 0 : static_cast<uint64_t>((time - _start) / _tick);
+    }
+
+    uint64_t deadline_tick(time_point deadline) const
+    {
+        if (deadline <= _start)
+        {
+            return 0;
+        }
+        auto span = deadline - _start;
+        auto ticks = static_cast<uint64_t>(span / _tick);
+        return span % _tick == duration::zero() ? ticks : ticks + 1;
+    }
+
+    uint32_t allocate()
+    {
+        if (_free != NIL)
+        {
+            auto index = _free;
+            _free = node(index)._next_free;
+            return index;
+        }
+        if ((_allocated & (CHUNK_SIZE - 1)) == 0)
+        {
+            _chunks.emplace_back(new entry_node[CHUNK_SIZE]);
+        }
+        auto& entry = node(_allocated);
+        entry._generation = 0;
+        entry._scheduled = false;
+        return _allocated++;
+    }
+
+    // The generation bump makes every handle and slot record for this node stale
+    void release(uint32_t index) noexcept
+    {
+        auto& entry = node(index);
+        entry._scheduled = false;
+        ++entry._generation;
+        entry._next_free = _free;
+        _free = index;
+    }
+
+    // Adds a record to the bucket its deadline belongs to, relative to the current tick
+    void file(const slot_record& record)
+    {
+        uint32_t bucket = DUE_BUCKET;
+        if (record._deadline > _now)
+        {
+            auto differing = record._deadline ^ _now;
+            size_t level = (63 - __builtin_clzll(differing)) / SLOT_BITS;
+            if (level < LEVELS)
+            {
+                bucket = bucket_of(level, record._deadline);
+                _occupied[level] |= uint64_t(1) << (bucket % SLOTS);
+            }
+            else
+            {
+                bucket = BEYOND_WHEEL;
+            }
+        }
+        _buckets[bucket].push_back(record);
+    }
+
+    // Empties a bucket into _firing, keeping both allocations for reuse
+    void take(uint32_t bucket) noexcept
+    {
+        _firing.clear();
+        _firing.swap(_buckets[bucket]);
+        if (bucket < DUE_BUCKET)
+        {
+            _occupied[bucket / SLOTS] &= ~(uint64_t(1) << (bucket % SLOTS));
+        }
+    }
+
+    // Smallest tick after _now at which a slot with entries becomes current, false if the wheel is empty.
+    // Lower levels' next slots come before any higher level's, so the first level with one decides.
+    bool next_event(uint64_t& tick) const noexcept
+    {
+        for (size_t level = 0; level < LEVELS; ++level)
+        {
+            auto shift = level * SLOT_BITS;
+            auto current = (_now >> shift) & (SLOTS - 1);
+            auto ahead = current == SLOTS - 1 ? 0 : _occupied[level] & (~uint64_t(0) << (current + 1));
+            if (ahead != 0)
+            {
+                auto window = (_now >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+                tick = window + (static_cast<uint64_t>(__builtin_ctzll(ahead)) << shift);
+                return true;
+            }
+        }
+        if (!_buckets[BEYOND_WHEEL].empty())
+        {
+            auto span = LEVELS * SLOT_BITS;
+            tick = ((_now >> span) + 1) << span;
+            return true;
+        }
+        return false;
+    }
+
+    // Re-files the higher-level slots that start at tick, top level first so nothing is filed twice
+    void cascade(uint64_t tick)
+    {
+        auto span = LEVELS * SLOT_BITS;
+        if ((tick & ((uint64_t(1) << span) - 1)) == 0)
+        {
+            refile(BEYOND_WHEEL);
+        }
+        for (auto level = LEVELS - 1; level > 0; --level)
+        {
+            if ((tick & ((uint64_t(1) << (level * SLOT_BITS)) - 1)) == 0)
+            {
+                refile(bucket_of(level, tick));
+            }
+        }
+    }
+
+    void refile(uint32_t bucket)
+    {
+        if (_buckets[bucket].empty())
+        {
+            return;
+        }
+        take(bucket);
+        for (const auto& record : _firing)
+        {
+            // A cancelled entry's node may already hold a new entry, which has a record of its own
+            if (live(record))
+            {
+                file(record);
+            }
+        }
+    }
+
+    // Fires the live records of a bucket. A callback may cancel an entry of the same batch that has not
+    // fired yet; its record is then stale and skipped. Entries a callback schedules land in other buckets,
+    // never in _firing, and ones already due make the DUE_BUCKET pass go round again.
+    template<typename Function>
+    size_type fire(uint32_t bucket, Function& on_expired)
+    {
+        size_type fired = 0;
+        while (!_buckets[bucket].empty())
+        {
+            take(bucket);
+            for (const auto& record : _firing)
+            {
+                if (!live(record))
+                {
+                    continue;
+                }
+                auto& entry = node(record._index);
+                value_type value(std::move(entry.value()));
+                entry.value().~value_type();
+                release(record._index);
+                --_size;
+                ++fired;
+                on_expired(std::move(value));
+            }
+        }
+        return fired;
+    }
+};
+
+template<typename DelayQueueDataType, typename Clock>
+const size_t DelayQueue<DelayQueueDataType, Clock>::SLOT_BITS;
+
+template<typename DelayQueueDataType, typename Clock>
+const size_t DelayQueue<DelayQueueDataType, Clock>::SLOTS;
+
+template<typename DelayQueueDataType, typename Clock>
+const size_t DelayQueue<DelayQueueDataType, Clock>::LEVELS;
+
+} // namespace stlcontainer
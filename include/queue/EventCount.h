@@ -0,0 +1,92 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace stlcontainer
+{
+
+// Hint to the core that the caller is spinning
+inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+// Lets threads sleep until a lock-free condition may have changed, without a mutex on the fast path.
+//
+// A waiter announces itself with prepare_wait(), re-checks its condition, then either cancel_wait()s or
+// commit_wait()s with the key prepare_wait() returned. A thread that changes the condition calls notify_all()
+// afterwards, which costs a fence and one load while nobody waits. Because the waiter is counted before it
+// re-checks and the notifier looks for waiters after it published, one of the two always sees the other, and
+// commit_wait returns at once if a notification came after prepare_wait.
+//
+// Sleeping uses a futex on Linux and falls back to yielding elsewhere.
+class EventCount
+{
+public:
+    using key_type = uint32_t;
+
+public:
+    EventCount() noexcept = default;
+    EventCount(const EventCount& other) = delete;
+    EventCount& operator=(const EventCount& other) = delete;
+
+    key_type prepare_wait() noexcept
+    {
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return _epoch.load(std::memory_order_acquire);
+    }
+
+    void cancel_wait() noexcept
+    {
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Sleeps unless notify_all ran since prepare_wait returned key. May wake spuriously.
+    void commit_wait(key_type key) noexcept
+    {
+        if (_epoch.load(std::memory_order_acquire) == key)
+        {
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch), FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+#else
+            std::this_thread::yield();
+#endif
+        }
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void notify_all() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_seq_cst) != 0)
+        {
+            _epoch.fetch_add(1, std::memory_order_acq_rel);
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+        }
+    }
+
+private:
+    std::atomic<key_type> _epoch{0};
+    std::atomic<uint32_t> _waiters{0};
+
+    static_assert(sizeof(std::atomic<key_type>) == sizeof(uint32_t), "futex needs a plain 32-bit word");
+};
+
+} // namespace stlcontainer
@@ -0,0 +1,273 @@
+#pragma once
+#include "stddef.h"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "DaryHeap.h"
+
+namespace stlcontainer
+{
+
+// Priority queue whose elements can be changed or removed after insertion, through the handle push returns.
+//
+// Keeps the same Arity-ary heap as PriorityQueue, of (value, handle) entries, plus a table from handle to heap
+// position that every sift keeps current. promote, update and erase are O(log n) and top stays O(1).
+// A handle stays valid until its element is popped or erased; after that push may hand it out again.
+// Compare works as for PriorityQueue: std::less gives a max-heap, std::greater a min-heap.
+template<typename PriorityQueueDataType, typename Compare = std::less<PriorityQueueDataType>, size_t Arity = 4>
+class IndexedPriorityQueue
+{
+public:
+    // Type definitions
+    using value_compare =   Compare;
+    using value_type =      PriorityQueueDataType;
+    using size_type =       size_t;
+    using handle_type =     size_t;
+    using const_reference = const value_type&;
+
+public:
+    // Member Functions: Constructors
+    // Default constructor
+    IndexedPriorityQueue() : IndexedPriorityQueue(Compare()) {};
+
+    explicit IndexedPriorityQueue(const Compare& compare) : _compare(compare) {};
+
+    // Range constructor, the elements get handles 0, 1, ... in range order. Heapifies once in O(n).
+    template<typename InputIterator>
+    IndexedPriorityQueue(InputIterator first, InputIterator last, const Compare& compare = Compare())
+        : _compare(compare)
+    {
+        for (; first != last; ++first)
+        {
+            _heap.push_back(entry{*first, _heap.size()});
+        }
+        _positions.resize(_heap.size());
+        heap::make_heap(_heap.begin(), _heap.size(), before(), track_move(*this));
+    }
+
+    // Member Functions: Element Access
+    const_reference top() const
+    {
+        return _heap.front()._value;
+    }
+
+    handle_type top_handle() const
+    {
+        return _heap.front()._handle;
+    }
+
+    const_reference value(handle_type handle) const
+    {
+        return _heap[_positions[handle]]._value;
+    }
+
+    // True while handle names an element in the queue
+    bool contains(handle_type handle) const noexcept
+    {
+        return handle < _positions.size() && _positions[handle] != NOT_QUEUED;
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _heap.empty();
+    }
+
+    size_type size() const noexcept
+    {
+        return _heap.size();
+    }
+
+    void reserve(size_type count)
+    {
+        _heap.reserve(count);
+        _positions.reserve(count);
+    }
+
+    // Member Functions: Modifiers
+    handle_type push(const value_type& value)
+    {
+        return emplace(value);
+    }
+
+    handle_type push(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+        auto handle = acquire_handle();
+        try
+        {
+            _heap.push_back(entry{value_type(std::forward<Args>(args)...), handle});
+        }
+        catch (...)
+        {
+            release_handle(handle);
+            throw;
+        }
+        heap::sift_up(_heap.begin(), _heap.size() - 1, before(), track_move(*this));
+        return handle;
+    }
+
+    void pop()
+    {
+        remove_at(0);
+    }
+
+    // Moves the top element into value and removes it, false when the queue is empty
+    bool try_pop(value_type& value)
+    {
+        if (_heap.empty())
+        {
+            return false;
+        }
+        value = std::move(_heap.front()._value);
+        pop();
+        return true;
+    }
+
+    // Raises handle's priority to value, moving it towards the top. Which way the key moves depends on
+    // Compare: a larger key under std::less, a smaller one (the textbook decrease-key) under std::greater.
+    // Throws std::invalid_argument if value has lower priority than the current one, use update for that.
+    void promote(handle_type handle, value_type value)
+    {
+        auto index = _positions[handle];
+        if (_compare(value, _heap[index]._value))
+        {
+            throw std::invalid_argument("stlcontainer::IndexedPriorityQueue::promote lowers the priority");
+        }
+        _heap[index]._value = std::move(value);
+        heap::sift_up(_heap.begin(), index, before(), track_move(*this));
+    }
+
+    // Replaces handle's value, moving it up or down as needed
+    void update(handle_type handle, value_type value)
+    {
+        auto index = _positions[handle];
+        _heap[index]._value = std::move(value);
+        heap::update(_heap.begin(), _heap.size(), index, before(), track_move(*this));
+    }
+
+    void erase(handle_type handle)
+    {
+        remove_at(_positions[handle]);
+    }
+
+    void clear() noexcept
+    {
+        _heap.clear();
+        _positions.clear();
+        _free_handles.clear();
+    }
+
+    void swap(IndexedPriorityQueue& other) noexcept
+    {
+        using std::swap;
+        swap(_compare, other._compare);
+        swap(_heap, other._heap);
+        swap(_positions, other._positions);
+        swap(_free_handles, other._free_handles);
+    }
+
+private:
+    using heap = stlcontainer::DaryHeap<Arity>;
+
+    static const size_t NOT_QUEUED = static_cast<size_t>(-1);
+
+    struct entry
+    {
+        value_type _value;
+        handle_type _handle;
+    };
+
+    // Records where each entry lands during a sift
+    struct track_move
+    {
+        IndexedPriorityQueue& _queue;
+
+        explicit track_move(IndexedPriorityQueue& queue) : _queue(queue) {}
+
+        void operator()(size_t index) const noexcept
+        {
+            _queue._positions[_queue._heap[index]._handle] = index;
+        }
+    };
+
+    Compare _compare;
+    std::vector<entry> _heap;
+    std::vector<size_t> _positions;             // Heap index per handle, NOT_QUEUED when free
+    std::vector<handle_type> _free_handles;     // Handles of popped or erased elements, reused first
+
+    // Higher priority goes above
+    auto before() const
+    {
+        const auto& compare = _compare;
+        return [&compare](const entry& lhs, const entry& rhs) { return compare(rhs._value, lhs._value); };
+    }
+
+    handle_type acquire_handle()
+    {
+        if (!_free_handles.empty())
+        {
+            auto handle = _free_handles.back();
+            _free_handles.pop_back();
+            return handle;
+        }
+        // Room for every handle, this one included, so emplace can hand it back without allocating
+        if (_free_handles.capacity() < _positions.size() + 1)
+        {
+            _free_handles.reserve(_positions.size() + 1);
+        }
+        _positions.push_back(NOT_QUEUED);
+        return _positions.size() - 1;
+    }
+
+    // Free handles never outnumber the handle table, which acquire_handle and remove_at reserve for, so
+    // this does not allocate
+    void release_handle(handle_type handle) noexcept
+    {
+        _positions[handle] = NOT_QUEUED;
+        _free_handles.push_back(handle);
+    }
+
+    // Fills the hole with the last entry and re-sifts it from there
+    void remove_at(size_t index)
+    {
+        if (_free_handles.capacity() < _positions.size())
+        {
+            _free_handles.reserve(_positions.size());
+        }
+        auto handle = _heap[index]._handle;
+        auto last = _heap.size() - 1;
+        if (index != last)
+        {
+            _heap[index] = std::move(_heap[last]);
+            _heap.pop_back();
+            heap::update(_heap.begin(), _heap.size(), index, before(), track_move(*this));
+        }
+        else
+        {
+            _heap.pop_back();
+        }
+        release_handle(handle);
+    }
+};
+
+template<typename PriorityQueueDataType, typename Compare, size_t Arity>
+const size_t IndexedPriorityQueue<PriorityQueueDataType, Compare, Arity>::NOT_QUEUED;
+
+// Non-Member Functions: Swap
+template<class PriorityQueueDataType, class Compare, size_t Arity>
+void swap(IndexedPriorityQueue<PriorityQueueDataType, Compare, Arity>& lhs,
+    IndexedPriorityQueue<PriorityQueueDataType, Compare, Arity>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
@@ -0,0 +1,394 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "CacheLine.h"
+#include "EventCount.h"
+
+namespace stlcontainer
+{
+
+// Bounded lock-free FIFO for any number of producer and consumer threads (Dmitry Vyukov's design).
+//
+// Every slot carries a sequence number that says whose turn it is. For the slot at running position pos,
+// sequence == pos means free for the producer claiming pos, pos + 1 means filled for the consumer claiming
+// pos, and the consumer hands it to the next lap by storing pos + capacity. Producers claim positions with a
+// CAS on the enqueue index and consumers on the dequeue index, so the two sides only meet on slots that are
+// actually full or empty, never on a shared lock. The ring size is a power of two, at least 2.
+//
+// try_ operations never block. push, pop, push_n and pop_n spin for a while, yield a few times, and then
+// sleep on an EventCount until the other side makes room or data. Construction and destruction are not thread-safe.
+template<typename QueueDataType>
+class MPMCQueue
+{
+public:
+    // Type definitions
+    using value_type =      QueueDataType;
+    using size_type =       size_t;
+    using reference =       value_type&;
+    using const_reference = const value_type&;
+
+    // Failed attempts a blocking operation spins through, then yields through, before it sleeps
+    static const size_t SPIN_LIMIT = 128;
+    static const size_t YIELD_LIMIT = 16;
+
+public:
+    // Member Functions: Constructors
+    // Holds at least capacity elements, rounded up to a power of two
+    explicit MPMCQueue(size_type capacity)
+        : _mask(round_up_to_power_of_two(capacity) - 1),
+          _slots(new slot_type[_mask + 1])
+    {
+        for (size_type index = 0; index <= _mask; ++index)
+        {
+            _slots[index]._sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue& other) = delete;
+    MPMCQueue& operator=(const MPMCQueue& other) = delete;
+
+    // Member Functions: Destructor
+    ~MPMCQueue()
+    {
+        auto tail = _enqueue_pos.load(std::memory_order_relaxed);
+        for (auto head = _dequeue_pos.load(std::memory_order_relaxed); head != tail; ++head)
+        {
+            _slots[head & _mask].value().~value_type();
+        }
+    }
+
+    // Member Functions: Capacity
+    size_type capacity() const noexcept
+    {
+        return _mask + 1;
+    }
+
+    // Snapshot, includes elements whose push or pop is still in progress
+    size_type size() const noexcept
+    {
+        auto head = _dequeue_pos.load(std::memory_order_acquire);
+        auto tail = _enqueue_pos.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    // Member Functions: Non-blocking
+    // Returns false and leaves value untouched when the queue is full
+    bool try_push(const value_type& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(value_type&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        auto pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& slot = _slots[pos & _mask];
+            auto lag = distance(slot._sequence.load(std::memory_order_acquire), pos);
+            if (lag == 0)
+            {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    construct(slot, pos, std::forward<Args>(args)...);
+                    _not_empty.notify_all();
+                    return true;
+                }
+            }
+            else if (lag < 0)
+            {
+                // The slot still holds the element from the previous lap
+                return false;
+            }
+            else
+            {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Moves the oldest element into value, false when the queue is empty
+    bool try_pop(value_type& value)
+    {
+        auto pos = _dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& slot = _slots[pos & _mask];
+            auto lag = distance(slot._sequence.load(std::memory_order_acquire), pos + 1);
+            if (lag == 0)
+            {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    take(slot, pos, value);
+                    _not_full.notify_all();
+                    return true;
+                }
+            }
+            else if (lag < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Pushes up to count elements read from first with one claim on the enqueue index, as many as there
+    // are free slots in a row. Returns how many were pushed.
+    template<typename InputIterator>
+    size_type try_push_n(InputIterator first, size_type count)
+    {
+        return push_n_from(first, count);
+    }
+
+    // Pops up to max consecutive elements into out with one claim on the dequeue index. Returns how many.
+    template<typename OutputIterator>
+    size_type try_pop_n(OutputIterator out, size_type max)
+    {
+        auto pos = _dequeue_pos.load(std::memory_order_relaxed);
+        while (max != 0)
+        {
+            size_type claimable = 0;
+            while (claimable < max && claimable <= _mask
+                && _slots[(pos + claimable) & _mask]._sequence.load(std::memory_order_acquire) == pos + claimable + 1)
+            {
+                ++claimable;
+            }
+            if (claimable == 0)
+            {
+                auto lag = distance(_slots[pos & _mask]._sequence.load(std::memory_order_acquire), pos + 1);
+                if (lag < 0)
+                {
+                    return 0;
+                }
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (_dequeue_pos.compare_exchange_weak(pos, pos + claimable, std::memory_order_relaxed))
+            {
+                for (size_type index = 0; index < claimable; ++index, ++out)
+                {
+                    auto& slot = _slots[(pos + index) & _mask];
+                    *out = std::move(slot.value());
+                    release(slot, pos + index);
+                }
+                _not_full.notify_all();
+                return claimable;
+            }
+        }
+        return 0;
+    }
+
+    // Member Functions: Blocking
+    void push(const value_type& value)
+    {
+        wait_until(_not_full, [&] { return try_push(value); });
+    }
+
+    void push(value_type&& value)
+    {
+        wait_until(_not_full, [&] { return try_push(std::move(value)); });
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        wait_until(_not_full, [&] { return try_emplace(std::forward<Args>(args)...); });
+    }
+
+    void pop(value_type& value)
+    {
+        wait_until(_not_empty, [&] { return try_pop(value); });
+    }
+
+    // Pushes all count elements, in batches as room frees up
+    template<typename InputIterator>
+    void push_n(InputIterator first, size_type count)
+    {
+        while (count != 0)
+        {
+            size_type pushed = 0;
+            wait_until(_not_full, [&] { return (pushed = push_n_from(first, count)) != 0; });
+            count -= pushed;
+        }
+    }
+
+    // Waits for at least one element, then pops up to max. Returns how many.
+    template<typename OutputIterator>
+    size_type pop_n(OutputIterator out, size_type max)
+    {
+        size_type popped = 0;
+        if (max != 0)
+        {
+            wait_until(_not_empty, [&] { return (popped = try_pop_n(out, max)) != 0; });
+        }
+        return popped;
+    }
+
+private:
+    struct slot_type
+    {
+        std::atomic<size_type> _sequence;
+        typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type _storage;
+
+        value_type& value() noexcept
+        {
+            return *reinterpret_cast<value_type*>(&_storage);
+        }
+    };
+
+    // Padding instead of alignas: C++14 operator new does not honour over-alignment. Read-only fields first.
+    const size_type _mask;
+    const std::unique_ptr<slot_type[]> _slots;
+    char _pad_shared[CACHE_LINE_SIZE];
+
+    std::atomic<size_type> _enqueue_pos{0};
+    char _pad_enqueue[CACHE_LINE_SIZE];
+
+    std::atomic<size_type> _dequeue_pos{0};
+    char _pad_dequeue[CACHE_LINE_SIZE];
+
+    stlcontainer::EventCount _not_empty;     // Consumers sleep here
+    stlcontainer::EventCount _not_full;      // Producers sleep here
+    char _pad_events[CACHE_LINE_SIZE];
+
+    // Signed distance between running positions, valid across wrap-around of size_type
+    static std::intptr_t distance(size_type sequence, size_type pos) noexcept
+    {
+        return static_cast<std::intptr_t>(sequence - pos);
+    }
+
+    // try_push_n, leaving first at the next element to read so push_n can go on from there without reading
+    // a single-pass iterator twice
+    template<typename InputIterator>
+    size_type push_n_from(InputIterator& first, size_type count)
+    {
+        auto pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (count != 0)
+        {
+            size_type claimable = 0;
+            while (claimable < count && claimable <= _mask
+                && _slots[(pos + claimable) & _mask]._sequence.load(std::memory_order_acquire) == pos + claimable)
+            {
+                ++claimable;
+            }
+            if (claimable == 0)
+            {
+                auto lag = distance(_slots[pos & _mask]._sequence.load(std::memory_order_acquire), pos);
+                if (lag < 0)
+                {
+                    return 0;
+                }
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (_enqueue_pos.compare_exchange_weak(pos, pos + claimable, std::memory_order_relaxed))
+            {
+                // No increment past the last of the count elements: on a stream that would read one too many
+                for (size_type index = 0; index < claimable; ++index)
+                {
+                    construct(_slots[(pos + index) & _mask], pos + index, *first);
+                    if (index + 1 != count)
+                    {
+                        ++first;
+                    }
+                }
+                _not_empty.notify_all();
+                return claimable;
+            }
+        }
+        return 0;
+    }
+
+    // The slot is already claimed, so a constructor that throws here leaves it unpublished and stalls every
+    // later consumer. Element construction must not throw.
+    template<typename... Args>
+    void construct(slot_type& slot, size_type pos, Args&&... args)
+    {
+        new (&slot._storage) value_type(std::forward<Args>(args)...);
+        slot._sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    void take(slot_type& slot, size_type pos, value_type& value)
+    {
+        value = std::move(slot.value());
+        release(slot, pos);
+    }
+
+    void release(slot_type& slot, size_type pos) noexcept
+    {
+        slot.value().~value_type();
+        slot._sequence.store(pos + _mask + 1, std::memory_order_release);
+    }
+
+    template<typename Attempt>
+    static void wait_until(stlcontainer::EventCount& event, Attempt&& attempt)
+    {
+        for (size_t spin = 0; spin < SPIN_LIMIT; ++spin)
+        {
+            if (attempt())
+            {
+                return;
+            }
+            stlcontainer::cpu_relax();
+        }
+        for (size_t round = 0; round < YIELD_LIMIT; ++round)
+        {
+            if (attempt())
+            {
+                return;
+            }
+            std::this_thread::yield();
+        }
+        while (true)
+        {
+            auto key = event.prepare_wait();
+            if (attempt())
+            {
+                event.cancel_wait();
+                return;
+            }
+            event.commit_wait(key);
+        }
+    }
+
+    static size_type round_up_to_power_of_two(size_type capacity) noexcept
+    {
+        size_type rounded = 2;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+};
+
+template<typename QueueDataType>
+const size_t MPMCQueue<QueueDataType>::SPIN_LIMIT;
+
+template<typename QueueDataType>
+const size_t MPMCQueue<QueueDataType>::YIELD_LIMIT;
+
+} // namespace stlcontainer
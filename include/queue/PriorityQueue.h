@@ -0,0 +1,183 @@
+#pragma once
+#include "stddef.h"
+
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "DaryHeap.h"
+#include "vector/Vector.h"
+
+namespace stlcontainer
+{
+
+// Container adapter giving constant-time access to the largest element (by Compare), like
+// std::priority_queue, kept as an Arity-ary heap (see DaryHeap.h) rather than a binary one.
+//
+// The container must be a SequenceContainer with random-access iterators and front(), push_back() and
+// pop_back(); stlcontainer::Vector by default, like Stack. Compare(a, b) true means a has lower priority than b, so std::less gives a max-heap and
+// std::greater a min-heap.
+template<typename PriorityQueueDataType, typename Compare = std::less<PriorityQueueDataType>,
+    typename Container = stlcontainer::Vector<PriorityQueueDataType>, size_t Arity = 4>
+class PriorityQueue
+{
+public:
+    // Type definitions
+    using container_type =  Container;
+    using value_compare =   Compare;
+    using value_type =      typename Container::value_type;
+    using size_type =       typename Container::size_type;
+    using reference =       typename Container::reference;
+    using const_reference = typename Container::const_reference;
+
+public:
+    // Member Functions: Constructors
+    // Default constructor
+    PriorityQueue() : PriorityQueue(Compare()) {};
+
+    explicit PriorityQueue(const Compare& compare) : _compare(compare) {};
+
+    // Copy container constructor, heapifies the contents in O(n)
+    PriorityQueue(const Compare& compare, const Container& cont) : _compare(compare), _container(cont)
+    {
+        make_heap();
+    }
+
+    // Move container constructor, heapifies the contents in O(n)
+    PriorityQueue(const Compare& compare, Container&& cont) : _compare(compare), _container(std::move(cont))
+    {
+        make_heap();
+    }
+
+    // Range constructor, appends [first, last) and heapifies once in O(n)
+    template<typename InputIterator>
+    PriorityQueue(InputIterator first, InputIterator last, const Compare& compare = Compare())
+        : _compare(compare)
+    {
+        push_range(first, last);
+    }
+
+    // Member Functions: Element Access
+    const_reference top() const
+    {
+        return _container.front();
+    }
+
+    // Member Functions: Capacity
+    bool empty() const
+    {
+        return _container.empty();
+    }
+
+    size_type size() const
+    {
+        return _container.size();
+    }
+
+    // Member Functions: Modifiers
+    void push(const value_type& value)
+    {
+        _container.push_back(value);
+        sift_up(_container.size() - 1);
+    }
+
+    void push(value_type&& value)
+    {
+        _container.push_back(std::move(value));
+        sift_up(_container.size() - 1);
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        _container.emplace_back(std::forward<Args>(args)...);
+        sift_up(_container.size() - 1);
+    }
+
+    // Appends [first, last). Rebuilds the heap in one O(n) pass when that beats sifting each new element up.
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last)
+    {
+        auto before = _container.size();
+        for (; first != last; ++first)
+        {
+            _container.push_back(*first);
+        }
+        auto added = _container.size() - before;
+        if (added > before)
+        {
+            make_heap();
+        }
+        else
+        {
+            for (auto index = before; index < _container.size(); ++index)
+            {
+                sift_up(index);
+            }
+        }
+    }
+
+    void pop()
+    {
+        heap::pop(_container.begin(), _container.size(), before(), ignore_move());
+        _container.pop_back();
+    }
+
+    // Moves the top element into value and removes it, false when the queue is empty
+    bool try_pop(value_type& value)
+    {
+        if (_container.empty())
+        {
+            return false;
+        }
+        value = std::move(_container.front());
+        pop();
+        return true;
+    }
+
+    void swap(PriorityQueue& other) noexcept
+    {
+        using std::swap;
+        swap(_compare, other._compare);
+        swap(_container, other._container);
+    }
+
+protected:
+    Compare _compare;
+    Container _container;
+
+private:
+    using heap = stlcontainer::DaryHeap<Arity>;
+
+    struct ignore_move
+    {
+        void operator()(size_t) const noexcept {}
+    };
+
+    // Higher priority goes above
+    auto before() const
+    {
+        const auto& compare = _compare;
+        return [&compare](const value_type& lhs, const value_type& rhs) { return compare(rhs, lhs); };
+    }
+
+    void sift_up(size_type index)
+    {
+        heap::sift_up(_container.begin(), index, before(), ignore_move());
+    }
+
+    void make_heap()
+    {
+        heap::make_heap(_container.begin(), _container.size(), before(), ignore_move());
+    }
+};
+
+// Non-Member Functions: Swap
+template<class PriorityQueueDataType, class Compare, class Container, size_t Arity>
+void swap(PriorityQueue<PriorityQueueDataType, Compare, Container, Arity>& lhs,
+    PriorityQueue<PriorityQueueDataType, Compare, Container, Arity>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
@@ -1,6 +1,11 @@
+#pragma once
 #include "stddef.h"
 
+#include <algorithm>
 #include <deque>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace stlcontainer 
 {
@@ -31,30 +36,46 @@ public:
     Queue(const Queue& other): _container(other._container) {};
 
     // Move constructor
-    Queue(Queue&& other): _container(std::move(other._container)) {};
+    Queue(Queue&& other) noexcept(std::is_nothrow_move_constructible<Container>::value)
+        : _container(std::move(other._container)) {};
 
     // Member Functions: Destructor
     ~Queue() = default;
 
     // Member Functions: Assignment Operator
-    Queue& operator=(const Container& other)
+    // Copies throw only if copying the container does; moves take over the source's storage in O(1)
+    Queue& operator=(const Queue& other) noexcept(std::is_nothrow_copy_assignable<Container>::value)
     {
-        if (this != &other) 
-        {
-            _container = other._container;
-        }
+        _container = other._container;
         return *this;
     }
 
-    Queue& operator=(Container&& other)
+    Queue& operator=(Queue&& other) noexcept(std::is_nothrow_move_assignable<Container>::value)
     {
-        if (this != &other)
-        {
-            delete[] _container;
-            _container = std::move(other._container);
-            other._container = nullptr;
-        }
-        return *this;  
+        _container = std::move(other._container);
+        return *this;
+    }
+
+    Queue& operator=(const Container& other) noexcept(std::is_nothrow_copy_assignable<Container>::value)
+    {
+        _container = other;
+        return *this;
+    }
+
+    // Hands a prebuilt batch to the queue without copying it, front of the container first out
+    Queue& operator=(Container&& other) noexcept(std::is_nothrow_move_assignable<Container>::value)
+    {
+        _container = std::move(other);
+        return *this;
+    }
+
+    // Member Functions: Container Access
+    // Moves the underlying container out, leaving the queue empty. The counterpart of operator=(Container&&).
+    Container take_container() noexcept(std::is_nothrow_move_constructible<Container>::value)
+    {
+        Container taken(std::move(_container));
+        _container.clear();
+        return taken;
     }
 
     // Member Functions: Element Access
@@ -105,6 +126,34 @@ public:
         _container.pop_front();
     }
 
+    // Appends [first, last) in order. Uses the container's range insert when it has one, so a std::deque
+    // grows once per block instead of checking capacity per element.
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last)
+    {
+        push_range(first, last, 0);
+    }
+
+    // Moves the oldest element into value and removes it, false when the queue is empty
+    bool try_pop(value_type& value)
+    {
+        if (_container.empty())
+        {
+            return false;
+        }
+        value = std::move(_container.front());
+        _container.pop_front();
+        return true;
+    }
+
+    // Moves up to max_n of the oldest elements, oldest first, into out and removes them. Returns how many.
+    // Uses a single range erase when the container has one, which releases whole std::deque blocks at once.
+    template<typename OutputIterator>
+    size_type pop_into(OutputIterator out, size_type max_n)
+    {
+        return pop_into(out, std::min(max_n, _container.size()), 0);
+    }
+
     void swap(Queue& other) noexcept
     {
         std::swap(_container, other._container);
@@ -133,6 +182,75 @@ public:
 
 protected:
     Container _container;    
+
+private:
+    // Below this many elements a range insert or erase costs more than its per-call setup saves
+    static const size_type SMALL_BATCH = 16;
+
+    template<typename ForwardIterator>
+    static bool is_small_batch(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+    {
+        return static_cast<size_type>(std::distance(first, last)) < SMALL_BATCH;
+    }
+
+    // A single-pass range cannot be measured without consuming it
+    template<typename InputIterator>
+    static bool is_small_batch(InputIterator, InputIterator, std::input_iterator_tag)
+    {
+        return false;
+    }
+
+    // Overloads ranked by their last argument: int beats long, and SFINAE drops the bulk form for containers
+    // that lack the range operation. Cont defers the check to the call so it can fail softly.
+    template<typename InputIterator, typename Cont = Container>
+    auto push_range(InputIterator first, InputIterator last, int)
+        -> decltype(std::declval<Cont&>().insert(std::declval<Cont&>().end(), first, last), void())
+    {
+        if (is_small_batch(first, last, typename std::iterator_traits<InputIterator>::iterator_category()))
+        {
+            push_range(first, last, 0L);
+        }
+        else
+        {
+            _container.insert(_container.end(), first, last);
+        }
+    }
+
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last, long)
+    {
+        for (; first != last; ++first)
+        {
+            _container.push_back(*first);
+        }
+    }
+
+    template<typename OutputIterator, typename Cont = Container>
+    auto pop_into(OutputIterator out, size_type count, int)
+        -> decltype(std::declval<Cont&>().erase(std::declval<Cont&>().begin(), std::declval<Cont&>().begin()),
+            size_type())
+    {
+        if (count < SMALL_BATCH)
+        {
+            return pop_into(out, count, 0L);
+        }
+        auto first = _container.begin();
+        auto last = std::next(first, count);
+        std::move(first, last, out);
+        _container.erase(first, last);
+        return count;
+    }
+
+    template<typename OutputIterator>
+    size_type pop_into(OutputIterator out, size_type count, long)
+    {
+        for (size_type index = 0; index < count; ++index, ++out)
+        {
+            *out = std::move(_container.front());
+            _container.pop_front();
+        }
+        return count;
+    }
 };
 
 // Non-Member Functions: Relational Operators
@@ -0,0 +1,372 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "RingBufferIterator.h"
+
+namespace stlcontainer
+{
+
+// Growable FIFO sequence in one contiguous allocation, usable as Queue's Container.
+//
+// Elements live in a ring of slots whose count is zero or a power of two. _head is the slot of the front
+// element and the element at offset i sits in slot (_head + i) & (capacity - 1), so push_back and pop_front
+// are one masked index each with no per-block indirection. When the ring is full, push_back moves the
+// elements into a ring twice the size, unwrapped so the front lands in slot 0; like std::vector growth this
+// invalidates iterators and references and leaves the buffer unchanged if an element's move throws.
+template<typename RingBufferDataType>
+class RingBuffer
+{
+public:
+    // Type definitions
+    using value_type =      RingBufferDataType;
+    using size_type =       size_t;
+    using reference =       value_type&;
+    using const_reference = const value_type&;
+    using iterator =        stlcontainer::RingBufferIterator<RingBufferDataType>;
+    using const_iterator =  const iterator;
+
+    // Slots allocated by the first push into an empty buffer
+    static const size_type MIN_CAPACITY = 8;
+
+public:
+    // Member Functions: Constructors
+    // Default constructor, allocates nothing until the first push
+    RingBuffer() = default;
+
+    // Initializer list constructor
+    RingBuffer(std::initializer_list<value_type> initList)
+    {
+        reserve(initList.size());
+        for (const auto& value : initList)
+        {
+            push_back(value);
+        }
+    }
+
+    // Copy constructor, the copy is packed from slot 0
+    RingBuffer(const RingBuffer& other)
+    {
+        reserve(other._size);
+        for (const auto& value : other)
+        {
+            push_back(value);
+        }
+    }
+
+    // Move constructor
+    RingBuffer(RingBuffer&& other) noexcept
+    {
+        swap(other);
+    }
+
+    // Member Functions: Destructor
+    ~RingBuffer()
+    {
+        clear();
+    }
+
+    // Member Functions: Assignment Operator
+    RingBuffer& operator=(const RingBuffer& other)
+    {
+        if (this != &other)
+        {
+            RingBuffer copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    RingBuffer& operator=(RingBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    // Member Functions: Element Access
+    reference front()
+    {
+        return at_offset(0);
+    }
+
+    const_reference front() const
+    {
+        return at_offset(0);
+    }
+
+    reference back()
+    {
+        return at_offset(_size - 1);
+    }
+
+    const_reference back() const
+    {
+        return at_offset(_size - 1);
+    }
+
+    // Offset from the front
+    reference operator[](size_type pos)
+    {
+        return at_offset(pos);
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        return at_offset(pos);
+    }
+
+    // Member Functions: Iterators
+    iterator begin() noexcept
+    {
+        return iterator(elements(), mask(), _head);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return iterator(elements(), mask(), _head);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(elements(), mask(), _head + _size);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return iterator(elements(), mask(), _head + _size);
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    size_type size() const noexcept
+    {
+        return _size;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    // Grows to hold at least count elements, rounded up to a power of two
+    void reserve(size_type count)
+    {
+        if (count > _capacity)
+        {
+            relocate(round_up_to_power_of_two(count));
+        }
+    }
+
+    // Member Functions: Modifiers
+    void push_back(const value_type& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (_size == _capacity)
+        {
+            return grow_and_emplace_back(std::forward<Args>(args)...);
+        }
+        auto slot = &_slots[(_head + _size) & mask()];
+        new (slot) value_type(std::forward<Args>(args)...);
+        ++_size;
+        return *reinterpret_cast<value_type*>(slot);
+    }
+
+    void pop_front()
+    {
+        front().~value_type();
+        _head = (_head + 1) & mask();
+        --_size;
+    }
+
+    void pop_back()
+    {
+        back().~value_type();
+        --_size;
+    }
+
+    // Destroys every element, keeps the allocation
+    void clear() noexcept
+    {
+        for (size_type offset = 0; offset < _size; ++offset)
+        {
+            at_offset(offset).~value_type();
+        }
+        _head = 0;
+        _size = 0;
+    }
+
+    void swap(RingBuffer& other) noexcept
+    {
+        std::swap(_slots, other._slots);
+        std::swap(_capacity, other._capacity);
+        std::swap(_head, other._head);
+        std::swap(_size, other._size);
+    }
+
+private:
+    using slot_type = typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type;
+
+    std::unique_ptr<slot_type[]> _slots;
+    size_type _capacity = 0;       // Zero or a power of two
+    size_type _head = 0;           // Slot of the front element
+    size_type _size = 0;
+
+    size_type mask() const noexcept
+    {
+        return _capacity - 1;
+    }
+
+    value_type* elements() const noexcept
+    {
+        return reinterpret_cast<value_type*>(_slots.get());
+    }
+
+    value_type& at_offset(size_type offset) const noexcept
+    {
+        return elements()[(_head + offset) & mask()];
+    }
+
+    // The new element is built first, so a push of one of this buffer's own elements still reads it intact
+    template<typename... Args>
+    reference grow_and_emplace_back(Args&&... args)
+    {
+        auto capacity = std::max(_capacity * 2, static_cast<size_type>(MIN_CAPACITY));
+        std::unique_ptr<slot_type[]> slots(new slot_type[capacity]);
+        auto created = reinterpret_cast<value_type*>(&slots[_size]);
+        new (created) value_type(std::forward<Args>(args)...);
+        try
+        {
+            move_elements_to(reinterpret_cast<value_type*>(slots.get()));
+        }
+        catch (...)
+        {
+            created->~value_type();
+            throw;
+        }
+        install(std::move(slots), capacity);
+        ++_size;
+        return *created;
+    }
+
+    void relocate(size_type capacity)
+    {
+        std::unique_ptr<slot_type[]> slots(new slot_type[capacity]);
+        move_elements_to(reinterpret_cast<value_type*>(slots.get()));
+        install(std::move(slots), capacity);
+    }
+
+    // Move-constructs the elements, front first, into destination[0, _size). On a throw the moved-to
+    // copies are destroyed and the originals are untouched, since only nothrow moves are used.
+    void move_elements_to(value_type* destination)
+    {
+        size_type offset = 0;
+        try
+        {
+            for (; offset < _size; ++offset)
+            {
+                new (destination + offset) value_type(std::move_if_noexcept(at_offset(offset)));
+            }
+        }
+        catch (...)
+        {
+            while (offset != 0)
+            {
+                destination[--offset].~value_type();
+            }
+            throw;
+        }
+    }
+
+    // Destroys the old elements and takes slots, which already holds them unwrapped from slot 0
+    void install(std::unique_ptr<slot_type[]> slots, size_type capacity) noexcept
+    {
+        auto size = _size;
+        clear();
+        _slots = std::move(slots);
+        _capacity = capacity;
+        _size = size;
+    }
+
+    static size_type round_up_to_power_of_two(size_type count) noexcept
+    {
+        size_type rounded = 1;
+        while (rounded < count)
+        {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+};
+
+template<typename RingBufferDataType>
+const typename RingBuffer<RingBufferDataType>::size_type RingBuffer<RingBufferDataType>::MIN_CAPACITY;
+
+// Non-Member Functions: Relational Operators
+template<class RingBufferDataType>
+bool operator==(const RingBuffer<RingBufferDataType>& lhs, const RingBuffer<RingBufferDataType>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class RingBufferDataType>
+bool operator!=(const RingBuffer<RingBufferDataType>& lhs, const RingBuffer<RingBufferDataType>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<class RingBufferDataType>
+bool operator<(const RingBuffer<RingBufferDataType>& lhs, const RingBuffer<RingBufferDataType>& rhs)
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class RingBufferDataType>
+bool operator>(const RingBuffer<RingBufferDataType>& lhs, const RingBuffer<RingBufferDataType>& rhs)
+{
+    return rhs < lhs;
+}
+
+template<class RingBufferDataType>
+bool operator<=(const RingBuffer<RingBufferDataType>& lhs, const RingBuffer<RingBufferDataType>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template<class RingBufferDataType>
+bool operator>=(const RingBuffer<RingBufferDataType>& lhs, const RingBuffer<RingBufferDataType>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// Non-Member Functions: Swap
+template<class RingBufferDataType>
+void swap(RingBuffer<RingBufferDataType>& lhs, RingBuffer<RingBufferDataType>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
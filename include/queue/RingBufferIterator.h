@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+namespace stlcontainer
+{
+
+template<typename RingBufferDataType> class RingBuffer;     // Forward declare
+
+template<typename IterType>
+class RingBufferIterator : public std::iterator<
+    std::forward_iterator_tag,
+    IterType,
+    std::ptrdiff_t,
+    IterType*,
+    IterType&>
+{
+// Friend declarations
+friend class RingBuffer<IterType>;
+
+// Type definitions
+public:
+    using value_type =        IterType;
+    using reference =         IterType&;
+    using const_reference =   const reference;
+    using iterator =          typename stlcontainer::RingBufferIterator<IterType>;
+    using const_iterator =    const iterator;
+
+public:
+
+    // Deference
+    reference operator* () const
+    {
+        return _elements[_index & _mask];
+    }
+
+    // Increment/move, the running index wraps through the mask
+    iterator& operator++()
+    {
+        ++_index;
+        return *this;
+    }
+
+    // Increment by value
+    iterator operator++(int)
+    {
+        iterator returnval(_elements, _mask, _index);
+        ++(*this);
+        return returnval;
+    }
+
+    // Comparison operator, equality
+    bool operator==(iterator other) const
+    {
+        return _index == other._index;
+    }
+
+    // Comparison operator, inequality
+    bool operator!=(iterator other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    IterType* _elements;
+    size_t _mask;
+    size_t _index;      // Unmasked: head + offset, so end() differs from begin() on a full buffer
+    RingBufferIterator(IterType* elements, size_t mask, size_t index)
+        : _elements(elements), _mask(mask), _index(index) {};
+};
+
+} // namespace stlcontainer
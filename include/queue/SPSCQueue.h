@@ -0,0 +1,173 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "CacheLine.h"
+
+namespace stlcontainer
+{
+
+// Bounded lock-free FIFO for exactly one producer thread and one consumer thread.
+//
+// Slots form a ring whose size is rounded up to a power of two, so a position is an index masked with
+// capacity - 1. The producer only writes _tail and the consumer only writes _head; both indices count up
+// forever and the ring is full when they are capacity apart. Each side also keeps a private copy of the
+// other side's index and re-reads the shared one only when its copy says full (producer) or empty
+// (consumer), so in steady state a push or pop touches no cache line the other thread writes.
+//
+// try_push, try_emplace, try_pop, front and pop are wait-free. Construction and destruction are not
+// thread-safe.
+template<typename QueueDataType>
+class SPSCQueue
+{
+public:
+    // Type definitions
+    using value_type =      QueueDataType;
+    using size_type =       size_t;
+    using reference =       value_type&;
+    using const_reference = const value_type&;
+
+public:
+    // Member Functions: Constructors
+    // Holds at least capacity elements, rounded up to a power of two
+    explicit SPSCQueue(size_type capacity)
+        : _mask(round_up_to_power_of_two(capacity) - 1),
+          _slots(new slot_type[_mask + 1])
+    {
+    }
+
+    SPSCQueue(const SPSCQueue& other) = delete;
+    SPSCQueue& operator=(const SPSCQueue& other) = delete;
+
+    // Member Functions: Destructor
+    ~SPSCQueue()
+    {
+        auto tail = _tail.load(std::memory_order_relaxed);
+        for (auto head = _head.load(std::memory_order_relaxed); head != tail; ++head)
+        {
+            value_at(head).~value_type();
+        }
+    }
+
+    // Member Functions: Capacity
+    size_type capacity() const noexcept
+    {
+        return _mask + 1;
+    }
+
+    // Snapshots, exact only when called from the producer or the consumer while the other side is idle
+    size_type size() const noexcept
+    {
+        auto head = _head.load(std::memory_order_acquire);
+        return _tail.load(std::memory_order_acquire) - head;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    // Member Functions: Producer
+    // Returns false and leaves value untouched when the queue is full
+    bool try_push(const value_type& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(value_type&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        auto tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cached_head == capacity())
+        {
+            _cached_head = _head.load(std::memory_order_acquire);
+            if (tail - _cached_head == capacity())
+            {
+                return false;
+            }
+        }
+        new (&_slots[tail & _mask]) value_type(std::forward<Args>(args)...);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Member Functions: Consumer
+    // Moves the oldest element into value, false when the queue is empty
+    bool try_pop(value_type& value)
+    {
+        auto element = front();
+        if (!element)
+        {
+            return false;
+        }
+        value = std::move(*element);
+        pop();
+        return true;
+    }
+
+    // Oldest element, read in place, or nullptr when the queue is empty
+    value_type* front()
+    {
+        auto head = _head.load(std::memory_order_relaxed);
+        if (head == _cached_tail)
+        {
+            _cached_tail = _tail.load(std::memory_order_acquire);
+            if (head == _cached_tail)
+            {
+                return nullptr;
+            }
+        }
+        return &value_at(head);
+    }
+
+    // Removes the oldest element, front() must have returned it
+    void pop()
+    {
+        auto head = _head.load(std::memory_order_relaxed);
+        value_at(head).~value_type();
+        _head.store(head + 1, std::memory_order_release);
+    }
+
+private:
+    using slot_type = typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type;
+
+    // Padding instead of alignas: C++14 operator new does not honour over-alignment. Read-only fields first.
+    const size_type _mask;
+    const std::unique_ptr<slot_type[]> _slots;
+    char _pad_shared[CACHE_LINE_SIZE];
+
+    std::atomic<size_type> _tail{0};         // Next slot to write, written by the producer
+    size_type _cached_head = 0;              // Producer's copy of _head
+    char _pad_producer[CACHE_LINE_SIZE];
+
+    std::atomic<size_type> _head{0};         // Next slot to read, written by the consumer
+    size_type _cached_tail = 0;              // Consumer's copy of _tail
+    char _pad_consumer[CACHE_LINE_SIZE];
+
+    value_type& value_at(size_type index) noexcept
+    {
+        return *reinterpret_cast<value_type*>(&_slots[index & _mask]);
+    }
+
+    static size_type round_up_to_power_of_two(size_type capacity) noexcept
+    {
+        size_type rounded = 1;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+};
+
+} // namespace stlcontainer
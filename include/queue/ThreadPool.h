@@ -0,0 +1,354 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CacheLine.h"
+#include "EventCount.h"
+#include "WorkStealingDeque.h"
+
+namespace stlcontainer
+{
+
+// Counts the tasks spawned into it that have not finished yet. ThreadPool::wait returns once it drops to zero
+// and rethrows the first exception one of those tasks threw.
+class TaskGroup
+{
+public:
+    TaskGroup() noexcept = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+
+    bool done() const noexcept
+    {
+        return _pending.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class ThreadPool;
+
+    std::atomic<size_t> _pending{0};
+    std::atomic<bool> _failed{false};
+    std::exception_ptr _error;
+
+    void fail(std::exception_ptr error) noexcept
+    {
+        bool expected = false;
+        if (_failed.compare_exchange_strong(expected, true, std::memory_order_relaxed))
+        {
+            _error = std::move(error);
+        }
+    }
+};
+
+// Fork-join thread pool on work-stealing deques.
+//
+// Every worker owns a WorkStealingDeque. A task spawned from inside a worker goes to the bottom of that
+// worker's deque and is usually run by it next, while the work it spawned first waits at the top for idle
+// workers to steal; in a recursive split the stolen pieces are the big ones. Tasks spawned from other
+// threads go through a shared, locked queue. Idle workers spin, yield, then sleep on an EventCount, so an
+// idle pool costs nothing and spawning into a busy one costs no system call.
+//
+// wait() does not block while there is work: the waiting thread runs tasks itself until its group is done,
+// which keeps nested fork-join from deadlocking however few workers there are. All groups must be waited
+// for before the pool is destroyed; tasks still queued then are discarded unrun.
+class ThreadPool
+{
+public:
+    // Failed searches for work an idle thread spins through, then yields through, before it sleeps
+    static const size_t SPIN_LIMIT = 64;
+    static const size_t YIELD_LIMIT = 16;
+
+public:
+    // Member Functions: Constructors
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+    {
+        threads = std::max<size_t>(threads, 1);
+        _workers.reserve(threads);
+        for (size_t index = 0; index < threads; ++index)
+        {
+            _workers.emplace_back(new worker);
+        }
+        try
+        {
+            for (size_t index = 0; index < threads; ++index)
+            {
+                _workers[index]->_thread = std::thread([this, index] { run_worker(index); });
+            }
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    // Member Functions: Destructor
+    ~ThreadPool()
+    {
+        stop();
+        for (auto& each : _workers)
+        {
+            task* job = nullptr;
+            while (each->_deque.try_pop(job))
+            {
+                delete job;
+            }
+        }
+        while (!_injected.empty())
+        {
+            delete _injected.front();
+            _injected.pop_front();
+        }
+    }
+
+    // Member Functions: Capacity
+    size_t size() const noexcept
+    {
+        return _workers.size();
+    }
+
+    // Member Functions: Tasks
+    // Queues function() to run on some thread of the pool as part of group
+    template<typename Function>
+    void spawn(TaskGroup& group, Function&& function)
+    {
+        std::unique_ptr<task> job(new task_type<typename std::decay<Function>::type>(group, std::forward<Function>(function)));
+        group._pending.fetch_add(1, std::memory_order_relaxed);
+        try
+        {
+            auto self = current_worker();
+            if (self != NO_WORKER)
+            {
+                _workers[self]->_deque.push(job.get());
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(_injected_mutex);
+                _injected.push_back(job.get());
+                _injected_size.store(_injected.size(), std::memory_order_relaxed);
+            }
+        }
+        catch (...)
+        {
+            group._pending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        job.release();
+        _work.notify_all();
+    }
+
+    // Runs queued tasks until every task of group has finished, then rethrows the first exception one threw
+    void wait(TaskGroup& group)
+    {
+        work_until(current_worker(), [&group] { return group.done(); });
+        if (group._failed.load(std::memory_order_relaxed))
+        {
+            group._failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(std::move(group._error));
+        }
+    }
+
+private:
+    struct task
+    {
+        TaskGroup& _group;
+
+        explicit task(TaskGroup& group) noexcept : _group(group) {}
+        virtual ~task() = default;
+        virtual void run() = 0;
+    };
+
+    template<typename Function>
+    struct task_type : task
+    {
+        Function _function;
+
+        template<typename Callable>
+        task_type(TaskGroup& group, Callable&& function)
+            : task(group), _function(std::forward<Callable>(function)) {}
+
+        void run() override
+        {
+            _function();
+        }
+    };
+
+    struct worker
+    {
+        WorkStealingDeque<task*> _deque;
+        std::thread _thread;
+    };
+
+    static const size_t NO_WORKER = SIZE_MAX;
+
+    std::vector<std::unique_ptr<worker>> _workers;
+
+    std::mutex _injected_mutex;
+    std::deque<task*> _injected;                    // Tasks spawned from outside the pool
+    std::atomic<size_t> _injected_size{0};          // Lets searches skip the lock while it is empty
+    char _pad_injected[CACHE_LINE_SIZE];
+
+    stlcontainer::EventCount _work;                 // Idle threads sleep here: new task, group done or stop
+    std::atomic<bool> _stopping{false};
+    char _pad_work[CACHE_LINE_SIZE];
+
+    // Index of the calling thread in this pool, NO_WORKER for threads outside it
+    size_t current_worker() const noexcept
+    {
+        if (this_thread_pool() != this)
+        {
+            return NO_WORKER;
+        }
+        return this_thread_index();
+    }
+
+    static const ThreadPool*& this_thread_pool() noexcept
+    {
+        static thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& this_thread_index() noexcept
+    {
+        static thread_local size_t index = NO_WORKER;
+        return index;
+    }
+
+    // Per-thread xorshift, picks where a search for victims starts so thieves spread out
+    static uint32_t next_random() noexcept
+    {
+        static thread_local uint32_t state = 0x9e3779b9u;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    void run_worker(size_t index)
+    {
+        this_thread_pool() = this;
+        this_thread_index() = index;
+        work_until(index, [this] { return _stopping.load(std::memory_order_acquire); });
+    }
+
+    void stop() noexcept
+    {
+        _stopping.store(true, std::memory_order_release);
+        _work.notify_all();
+        for (auto& each : _workers)
+        {
+            if (each->_thread.joinable())
+            {
+                each->_thread.join();
+            }
+        }
+    }
+
+    // Own deque first, newest task; then the shared queue; then the oldest task of some other worker
+    task* find_task(size_t self)
+    {
+        task* job = nullptr;
+        if (self != NO_WORKER && _workers[self]->_deque.try_pop(job))
+        {
+            return job;
+        }
+        if (_injected_size.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<std::mutex> lock(_injected_mutex);
+            if (!_injected.empty())
+            {
+                job = _injected.front();
+                _injected.pop_front();
+                _injected_size.store(_injected.size(), std::memory_order_relaxed);
+                return job;
+            }
+        }
+        auto count = _workers.size();
+        auto start = next_random() % count;
+        for (size_t offset = 0; offset < count; ++offset)
+        {
+            auto victim = (start + offset) % count;
+            if (victim != self && _workers[victim]->_deque.try_steal(job))
+            {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void execute(task* job) noexcept
+    {
+        auto& group = job->_group;
+        try
+        {
+            job->run();
+        }
+        catch (...)
+        {
+            group.fail(std::current_exception());
+        }
+        delete job;
+        // The group may be destroyed the moment it reaches zero, only the pool is touched afterwards
+        if (group._pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            _work.notify_all();
+        }
+    }
+
+    template<typename Done>
+    void work_until(size_t self, Done&& done)
+    {
+        size_t idle = 0;
+        while (!done())
+        {
+            if (auto job = find_task(self))
+            {
+                execute(job);
+                idle = 0;
+            }
+            else if (idle < SPIN_LIMIT)
+            {
+                ++idle;
+                stlcontainer::cpu_relax();
+            }
+            else if (idle < SPIN_LIMIT + YIELD_LIMIT)
+            {
+                ++idle;
+                std::this_thread::yield();
+            }
+            else
+            {
+                auto key = _work.prepare_wait();
+                if (done())
+                {
+                    _work.cancel_wait();
+                    return;
+                }
+                if (auto job = find_task(self))
+                {
+                    _work.cancel_wait();
+                    execute(job);
+                    idle = 0;
+                    continue;
+                }
+                _work.commit_wait(key);
+            }
+        }
+    }
+};
+
+} // namespace stlcontainer
@@ -0,0 +1,181 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "CacheLine.h"
+
+namespace stlcontainer
+{
+
+// Unbounded lock-free deque for work stealing (Chase and Lev, with the C11 orderings of Le et al., 2013).
+//
+// One thread, the owner, pushes and pops at the bottom in LIFO order, which keeps recently spawned work hot
+// in its cache. Any number of other threads steal from the top, taking the oldest and usually largest piece
+// of work. The two ends only contend when one element is left; then a CAS on the top index decides who gets
+// it. When the ring fills, the owner copies the live range into one twice the size and publishes it; old
+// rings stay allocated until the deque is destroyed, since a thief may still be reading one.
+//
+// Thieves read a slot before they know whether they won it, so slots are atomics and the element type must
+// be trivially copyable: typically a pointer or index naming a task.
+template<typename DequeDataType>
+class WorkStealingDeque
+{
+public:
+    // Type definitions
+    using value_type =      DequeDataType;
+    using size_type =       size_t;
+
+    static_assert(std::is_trivially_copyable<value_type>::value,
+        "thieves read slots concurrently with the owner, elements must be trivially copyable");
+
+public:
+    // Member Functions: Constructors
+    // Starts with at least capacity slots, rounded up to a power of two
+    explicit WorkStealingDeque(size_type capacity = 64)
+    {
+        _rings.emplace_back(new ring(round_up_to_power_of_two(capacity)));
+        _ring.store(_rings.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+
+    // Member Functions: Capacity
+    // Snapshot, exact only while no other thread is working on the deque
+    size_type size() const noexcept
+    {
+        auto bottom = _bottom.load(std::memory_order_relaxed);
+        auto top = _top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return _ring.load(std::memory_order_relaxed)->_mask + 1;
+    }
+
+    // Member Functions: Owner
+    void push(value_type value)
+    {
+        auto bottom = _bottom.load(std::memory_order_relaxed);
+        auto top = _top.load(std::memory_order_acquire);
+        auto slots = _ring.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<int64_t>(slots->_mask))
+        {
+            slots = grow(slots, top, bottom);
+        }
+        slots->store(bottom, value);
+        // A release store rather than the paper's release fence: same code, and visible to ThreadSanitizer
+        _bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    // Takes the newest element, false when the deque is empty or a thief won the last one
+    bool try_pop(value_type& value)
+    {
+        auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        auto slots = _ring.load(std::memory_order_relaxed);
+        // Store-load barrier: the claim on bottom must be visible before top is read. A seq_cst exchange is
+        // a locked instruction on x86, noticeably cheaper there than the paper's store plus mfence.
+        _bottom.exchange(bottom, std::memory_order_seq_cst);
+        auto top = _top.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        value = slots->load(bottom);
+        if (top < bottom)
+        {
+            return true;
+        }
+        // Last element: race the thieves for it
+        auto won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    // Member Functions: Thieves
+    // Takes the oldest element, false when the deque is empty or another thread got there first
+    bool try_steal(value_type& value)
+    {
+        auto top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto bottom = _bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return false;
+        }
+        auto slots = _ring.load(std::memory_order_acquire);
+        auto stolen = slots->load(top);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        value = stolen;
+        return true;
+    }
+
+private:
+    struct ring
+    {
+        const int64_t _mask;
+        std::unique_ptr<std::atomic<value_type>[]> _slots;
+
+        explicit ring(size_type capacity)
+            : _mask(static_cast<int64_t>(capacity) - 1), _slots(new std::atomic<value_type>[capacity]) {}
+
+        value_type load(int64_t index) const noexcept
+        {
+            return _slots[index & _mask].load(std::memory_order_relaxed);
+        }
+
+        void store(int64_t index, value_type value) noexcept
+        {
+            _slots[index & _mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    // Indices count up forever; bottom - top is the size. Kept on separate lines: thieves hammer _top.
+    std::atomic<int64_t> _top{0};
+    char _pad_top[CACHE_LINE_SIZE];
+    std::atomic<int64_t> _bottom{0};
+    std::atomic<ring*> _ring{nullptr};
+    std::vector<std::unique_ptr<ring>> _rings;       // Owner only: every ring ever used, newest last
+    char _pad_bottom[CACHE_LINE_SIZE];
+
+    // Owner only. Elements keep their indices, so thieves holding the old ring read the same values.
+    ring* grow(ring* old, int64_t top, int64_t bottom)
+    {
+        _rings.emplace_back(new ring(static_cast<size_type>(old->_mask + 1) * 2));
+        auto slots = _rings.back().get();
+        for (auto index = top; index < bottom; ++index)
+        {
+            slots->store(index, old->load(index));
+        }
+        _ring.store(slots, std::memory_order_release);
+        return slots;
+    }
+
+    static size_type round_up_to_power_of_two(size_type capacity) noexcept
+    {
+        size_type rounded = 2;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+};
+
+} // namespace stlcontainer
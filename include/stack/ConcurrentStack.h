@@ -0,0 +1,339 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "queue/CacheLine.h"
+#include "queue/EventCount.h"
+
+namespace stlcontainer
+{
+
+// Bounded lock-free LIFO for any number of threads: a Treiber stack with an elimination-backoff array.
+//
+// Elements live in a pool of capacity nodes allocated up front, and nodes are linked by index. Two Treiber
+// stacks run over the pool: the elements, and the free nodes. Each top is one 64-bit word holding a node
+// index and a tag that every successful CAS increments. A pop that read top = A, then lost the CPU while A
+// was popped, reused and pushed again, finds the tag changed and retries instead of installing a stale next
+// (the ABA problem). Nodes are never returned to the allocator while the stack lives, so reading the next
+// field of a node another thread has just popped is always safe.
+//
+// Under contention a push or pop whose CAS on the top fails does not retry at once. It visits a random
+// slot of the elimination array instead. A push parks its node there for a short while, and a pop that
+// finds a parked node takes it. Such a pair cancels out without touching the top: a push immediately
+// followed by a pop. EliminationSlots = 0 turns this off.
+//
+// All operations are non-blocking. Construction and destruction are not thread-safe.
+template<typename StackDataType, size_t EliminationSlots = 8>
+class ConcurrentStack
+{
+public:
+    // Type definitions
+    using value_type =      StackDataType;
+    using size_type =       size_t;
+    using reference =       value_type&;
+    using const_reference = const value_type&;
+
+    // Pause rounds a push waits in an elimination slot for a pop before withdrawing its offer
+    static const size_t ELIMINATION_SPINS = 64;
+
+public:
+    // Member Functions: Constructors
+    explicit ConcurrentStack(size_type capacity)
+        : _capacity(checked_capacity(capacity)),
+          _nodes(new node_type[_capacity])
+    {
+        for (size_type index = 0; index < _capacity; ++index)
+        {
+            _nodes[index]._next.store(index + 1 < _capacity ? static_cast<uint32_t>(index + 1) : NIL,
+                std::memory_order_relaxed);
+        }
+        _free.store(pack(_capacity != 0 ? 0 : NIL, 0), std::memory_order_relaxed);
+    }
+
+    ConcurrentStack(const ConcurrentStack& other) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack& other) = delete;
+
+    // Member Functions: Destructor
+    ~ConcurrentStack()
+    {
+        for (auto index = index_of(_top.load(std::memory_order_relaxed)); index != NIL;
+             index = _nodes[index]._next.load(std::memory_order_relaxed))
+        {
+            _nodes[index].value().~value_type();
+        }
+    }
+
+    // Member Functions: Capacity
+    size_type capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    // Snapshot. A push parked in the elimination array does not count.
+    bool empty() const noexcept
+    {
+        return index_of(_top.load(std::memory_order_acquire)) == NIL;
+    }
+
+    // Member Functions: Modifiers
+    // Returns false and leaves value untouched when all capacity nodes are in use
+    bool try_push(const value_type& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(value_type&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        auto index = pop_index(_free);
+        if (index == NIL)
+        {
+            return false;
+        }
+        try
+        {
+            new (&_nodes[index]._storage) value_type(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            push_index(_free, index);
+            throw;
+        }
+        push_element(index);
+        return true;
+    }
+
+    // Moves the most recent element into value, false when the stack is empty. Element move assignment
+    // must not throw: the node is already unlinked.
+    bool try_pop(value_type& value)
+    {
+        auto index = pop_element();
+        if (index == NIL)
+        {
+            return false;
+        }
+        auto& node = _nodes[index];
+        value = std::move(node.value());
+        node.value().~value_type();
+        push_index(_free, index);
+        return true;
+    }
+
+private:
+    // Node indices that mark the end of a list, and a pop whose CAS lost a race
+    static const uint32_t NIL = UINT32_MAX;
+    static const uint32_t RETRY = NIL - 1;
+
+    struct node_type
+    {
+        std::atomic<uint32_t> _next;
+        typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type _storage;
+
+        value_type& value() noexcept
+        {
+            return *reinterpret_cast<value_type*>(&_storage);
+        }
+    };
+
+    // A parked node index, or NIL, and a tag that changes with every offer and take
+    struct exchanger_type
+    {
+        std::atomic<uint64_t> _offer{pack(NIL, 0)};
+        char _pad[CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)];
+    };
+
+    // Padding instead of alignas: C++14 operator new does not honour over-alignment. Read-only fields first.
+    const size_type _capacity;
+    const std::unique_ptr<node_type[]> _nodes;
+    char _pad_shared[CACHE_LINE_SIZE];
+
+    std::atomic<uint64_t> _top{pack(NIL, 0)};
+    char _pad_top[CACHE_LINE_SIZE];
+
+    std::atomic<uint64_t> _free{pack(NIL, 0)};
+    char _pad_free[CACHE_LINE_SIZE];
+
+    exchanger_type _exchangers[EliminationSlots == 0 ? 1 : EliminationSlots];
+
+    // Tagged words: the tag in the high half, a node index in the low half
+    static constexpr uint64_t pack(uint32_t index, uint32_t tag) noexcept
+    {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    static uint32_t index_of(uint64_t word) noexcept
+    {
+        return static_cast<uint32_t>(word);
+    }
+
+    static uint32_t next_tag(uint64_t word) noexcept
+    {
+        return static_cast<uint32_t>(word >> 32) + 1;
+    }
+
+    static size_type checked_capacity(size_type capacity)
+    {
+        if (capacity > RETRY)
+        {
+            throw std::length_error("stlcontainer::ConcurrentStack: capacity must fit a 32-bit node index");
+        }
+        return capacity;
+    }
+
+    // Treiber push and pop on either top. The release on push publishes the node's contents and next link to
+    // the thread whose acquiring CAS pops it.
+    bool try_push_index(std::atomic<uint64_t>& top, uint32_t index) noexcept
+    {
+        auto word = top.load(std::memory_order_relaxed);
+        _nodes[index]._next.store(index_of(word), std::memory_order_relaxed);
+        return top.compare_exchange_weak(word, pack(index, next_tag(word)), std::memory_order_release,
+            std::memory_order_relaxed);
+    }
+
+    void push_index(std::atomic<uint64_t>& top, uint32_t index) noexcept
+    {
+        while (!try_push_index(top, index))
+        {
+        }
+    }
+
+    // NIL when empty, RETRY when the CAS failed
+    uint32_t try_pop_index(std::atomic<uint64_t>& top) noexcept
+    {
+        auto word = top.load(std::memory_order_acquire);
+        auto index = index_of(word);
+        if (index == NIL)
+        {
+            return NIL;
+        }
+        // The node may be popped and reused before the CAS below, then the tag no longer matches
+        auto next = _nodes[index]._next.load(std::memory_order_relaxed);
+        return top.compare_exchange_weak(word, pack(next, next_tag(word)), std::memory_order_acquire,
+            std::memory_order_relaxed) ? index : RETRY;
+    }
+
+    uint32_t pop_index(std::atomic<uint64_t>& top) noexcept
+    {
+        auto index = try_pop_index(top);
+        while (index == RETRY)
+        {
+            index = try_pop_index(top);
+        }
+        return index;
+    }
+
+    void push_element(uint32_t index) noexcept
+    {
+        while (!try_push_index(_top, index))
+        {
+            if (EliminationSlots != 0 && offer(index))
+            {
+                return;
+            }
+        }
+    }
+
+    uint32_t pop_element() noexcept
+    {
+        while (true)
+        {
+            auto index = try_pop_index(_top);
+            if (index != RETRY)
+            {
+                return index;
+            }
+            if (EliminationSlots != 0 && (index = take()) != NIL)
+            {
+                return index;
+            }
+        }
+    }
+
+    // Parks index in a free exchanger and waits for a pop to take it. False when nobody did, and the node
+    // is still the caller's.
+    bool offer(uint32_t index) noexcept
+    {
+        auto& offer = exchanger()._offer;
+        auto word = offer.load(std::memory_order_relaxed);
+        if (index_of(word) != NIL)
+        {
+            return false;
+        }
+        auto parked = pack(index, next_tag(word));
+        if (!offer.compare_exchange_strong(word, parked, std::memory_order_release, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        for (size_t spin = 0; spin < ELIMINATION_SPINS; ++spin)
+        {
+            if (offer.load(std::memory_order_relaxed) != parked)
+            {
+                return true;
+            }
+            stlcontainer::cpu_relax();
+        }
+        // Withdraw, unless a pop took the node in the meantime
+        return !offer.compare_exchange_strong(parked, pack(NIL, next_tag(parked)), std::memory_order_relaxed);
+    }
+
+    // A node some push parked in a random exchanger, or NIL
+    uint32_t take() noexcept
+    {
+        auto& offer = exchanger()._offer;
+        auto word = offer.load(std::memory_order_relaxed);
+        auto index = index_of(word);
+        if (index == NIL)
+        {
+            return NIL;
+        }
+        // The acquire pairs with the release that parked the node, so its contents are visible
+        return offer.compare_exchange_strong(word, pack(NIL, next_tag(word)), std::memory_order_acquire,
+            std::memory_order_relaxed) ? index : NIL;
+    }
+
+    // Per-thread xorshift, spreads contending threads over the exchangers
+    exchanger_type& exchanger() noexcept
+    {
+        static thread_local uint32_t state = thread_seed();
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return _exchangers[state % (EliminationSlots == 0 ? 1 : EliminationSlots)];
+    }
+
+    // Differs per thread, so threads walk different slot sequences. The thread id is mixed first: ids are
+    // often addresses that share their low bits. Never zero, which xorshift would never leave.
+    static uint32_t thread_seed() noexcept
+    {
+        uint64_t id = std::hash<std::thread::id>()(std::this_thread::get_id());
+        id = (id ^ (id >> 33)) * 0xff51afd7ed558ccdull;
+        id ^= id >> 33;
+        auto seed = static_cast<uint32_t>(id ^ (id >> 32));
+        return seed != 0 ? seed : 0x9e3779b9u;
+    }
+};
+
+template<typename StackDataType, size_t EliminationSlots>
+const size_t ConcurrentStack<StackDataType, EliminationSlots>::ELIMINATION_SPINS;
+
+template<typename StackDataType, size_t EliminationSlots>
+const uint32_t ConcurrentStack<StackDataType, EliminationSlots>::NIL;
+
+template<typename StackDataType, size_t EliminationSlots>
+const uint32_t ConcurrentStack<StackDataType, EliminationSlots>::RETRY;
+
+} // namespace stlcontainer
@@ -0,0 +1,205 @@
+#pragma once
+#include "stddef.h"
+
+#include <atomic>
+#include <utility>
+
+namespace stlcontainer
+{
+
+// An immutable stack. push and pop leave the stack they are called on as it was and return a new one that
+// shares every node below the top with it, so a snapshot is a plain copy: O(1), no elements copied.
+//
+// Nodes are reference counted, atomically, so stacks sharing nodes may be used and destroyed on different
+// threads. Releasing a long chain unwinds in a loop, not by recursion. Popping a shared stack never frees
+// nodes another stack still uses.
+template<typename StackDataType>
+class PersistentStack
+{
+public:
+    // Type definitions
+    using value_type =      StackDataType;
+    using size_type =       size_t;
+    using const_reference = const value_type&;
+
+public:
+    // Member Functions: Constructors
+    // Default constructor, the empty stack
+    PersistentStack() noexcept : _head(nullptr) {}
+
+    // Copy constructor, shares all nodes
+    PersistentStack(const PersistentStack& other) noexcept : _head(other._head)
+    {
+        acquire(_head);
+    }
+
+    // Move constructor
+    PersistentStack(PersistentStack&& other) noexcept : _head(other._head)
+    {
+        other._head = nullptr;
+    }
+
+    // Member Functions: Destructor
+    ~PersistentStack()
+    {
+        release(_head);
+    }
+
+    // Member Functions: Assignment Operator
+    PersistentStack& operator=(const PersistentStack& other) noexcept
+    {
+        acquire(other._head);
+        release(_head);
+        _head = other._head;
+        return *this;
+    }
+
+    PersistentStack& operator=(PersistentStack&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release(_head);
+            _head = other._head;
+            other._head = nullptr;
+        }
+        return *this;
+    }
+
+    // Member Functions: Element Access
+    // The stack must not be empty
+    const_reference top() const noexcept
+    {
+        return _head->_value;
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _head == nullptr;
+    }
+
+    // O(1), each node records the size of the stack it tops
+    size_type size() const noexcept
+    {
+        return _head == nullptr ? 0 : _head->_size;
+    }
+
+    // Member Functions: Modifiers
+    // Each returns a new stack and leaves this one unchanged
+    PersistentStack push(const value_type& value) const
+    {
+        return emplace(value);
+    }
+
+    PersistentStack push(value_type&& value) const
+    {
+        return emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    PersistentStack emplace(Args&&... args) const
+    {
+        auto head = new node_type(_head, std::forward<Args>(args)...);
+        acquire(_head);
+        return PersistentStack(head);
+    }
+
+    // The stack must not be empty
+    PersistentStack pop() const noexcept
+    {
+        acquire(_head->_next);
+        return PersistentStack(_head->_next);
+    }
+
+    void swap(PersistentStack& other) noexcept
+    {
+        std::swap(_head, other._head);
+    }
+
+    // True when both stacks are the same snapshot: equal without comparing any element
+    bool shares_with(const PersistentStack& other) const noexcept
+    {
+        return _head == other._head;
+    }
+
+    // Declare relational operators as friends - need access to the nodes
+    template<class myStackDataType>
+    friend bool operator==(const PersistentStack<myStackDataType>& lhs, const PersistentStack<myStackDataType>& rhs);
+
+private:
+    struct node_type
+    {
+        template<typename... Args>
+        node_type(node_type* next, Args&&... args)
+            : _value(std::forward<Args>(args)...), _next(next), _size(next == nullptr ? 1 : next->_size + 1),
+              _references(1)
+        {
+        }
+
+        const value_type _value;
+        node_type* const _next;
+        const size_type _size;
+        std::atomic<size_type> _references;
+    };
+
+    node_type* _head;
+
+    // Takes over one reference to head
+    explicit PersistentStack(node_type* head) noexcept : _head(head) {}
+
+    static void acquire(node_type* node) noexcept
+    {
+        if (node != nullptr)
+        {
+            node->_references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Drops one reference, freeing the nodes nobody else uses. The acq_rel makes every earlier use of a node
+    // happen before its deletion.
+    static void release(node_type* node) noexcept
+    {
+        while (node != nullptr && node->_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            auto next = node->_next;
+            delete node;
+            node = next;
+        }
+    }
+};
+
+// Non-Member Functions: Relational Operators
+// Stops at the first node both stacks share: everything below it is equal
+template<class StackDataType>
+bool operator==(const PersistentStack<StackDataType>& lhs, const PersistentStack<StackDataType>& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    auto left = lhs._head;
+    auto right = rhs._head;
+    for (; left != right; left = left->_next, right = right->_next)
+    {
+        if (!(left->_value == right->_value))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class StackDataType>
+bool operator!=(const PersistentStack<StackDataType>& lhs, const PersistentStack<StackDataType>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// Non-Member Functions: Swap
+template<class StackDataType>
+void swap(PersistentStack<StackDataType>& lhs, PersistentStack<StackDataType>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
@@ -0,0 +1,395 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector/Vector.h"
+
+namespace stlcontainer
+{
+
+// A stack stored in fixed-size segments, for speculative execution: mark() records the current top,
+// rollback(mark) drops everything pushed since, commit(mark) keeps it.
+//
+// Segments are never moved, so growing does not copy elements the way a vector does. Segments above the top
+// are kept for the next push instead of being freed at once, so a stack that rises and falls across a
+// segment boundary does not hit the allocator each time; shrink_to_fit() releases them. For trivially
+// destructible elements rollback only moves the top back, O(1) whatever the number of elements and segments
+// it drops. Other elements are destroyed one by one.
+template<typename StackDataType, size_t SegmentSize = (sizeof(StackDataType) < 256 ? 4096 / sizeof(StackDataType) : 16)>
+class SegmentedStack
+{
+    static_assert(SegmentSize > 0, "SegmentedStack needs segments of at least one element");
+
+public:
+    // Type definitions
+    using value_type =      StackDataType;
+    using size_type =       size_t;
+    using reference =       value_type&;
+    using const_reference = const value_type&;
+
+    // A position to roll back to. Only meaningful for the stack that handed it out, and only while the
+    // stack has not been popped below it.
+    class mark_type
+    {
+    public:
+        size_type size() const noexcept { return _size; }
+
+    private:
+        friend class SegmentedStack;
+        explicit mark_type(size_type size) noexcept : _size(size) {}
+
+        size_type _size;
+    };
+
+public:
+    // Member Functions: Constructors
+    // Default constructor, allocates nothing
+    SegmentedStack() noexcept : _segment(0), _top(nullptr), _size(0) {}
+
+    // Copy constructor
+    SegmentedStack(const SegmentedStack& other) : SegmentedStack()
+    {
+        append_copies(other);
+    }
+
+    // Move constructor, takes over the segments
+    SegmentedStack(SegmentedStack&& other) noexcept : SegmentedStack()
+    {
+        swap(other);
+    }
+
+    // Member Functions: Destructor
+    ~SegmentedStack()
+    {
+        clear();
+        release_segments(0);
+    }
+
+    // Member Functions: Assignment Operator
+    SegmentedStack& operator=(const SegmentedStack& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            append_copies(other);
+        }
+        return *this;
+    }
+
+    SegmentedStack& operator=(SegmentedStack&& other) noexcept
+    {
+        if (this != &other)
+        {
+            SegmentedStack temp(std::move(other));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    // Member Functions: Element Access
+    reference top()
+    {
+        return _top[-1];
+    }
+
+    const_reference top() const
+    {
+        return _top[-1];
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    size_type size() const noexcept
+    {
+        return _size;
+    }
+
+    static constexpr size_type segment_size() noexcept
+    {
+        return SegmentSize;
+    }
+
+    // Segments allocated, including the spare ones above the top
+    size_type segment_count() const noexcept
+    {
+        return _segments.size();
+    }
+
+    // Frees the spare segments above the top
+    void shrink_to_fit() noexcept
+    {
+        release_segments(_size == 0 ? 0 : _segment + 1);
+        if (_segments.empty())
+        {
+            _segment = 0;
+            _top = nullptr;
+        }
+    }
+
+    // Member Functions: Modifiers
+    void push(const value_type& value)
+    {
+        emplace(value);
+    }
+
+    void push(value_type&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        if (_top == nullptr || _top == segment_end(_segment))
+        {
+            // args may refer to an element, which a new segment does not move
+            auto segment = _segment;
+            auto top = _top;
+            next_segment();
+            try
+            {
+                new (_top) value_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                // Back to the old top; the new segment stays as a spare
+                _segment = segment;
+                _top = top;
+                throw;
+            }
+        }
+        else
+        {
+            new (_top) value_type(std::forward<Args>(args)...);
+        }
+        ++_top;
+        ++_size;
+    }
+
+    // The stack must not be empty
+    void pop()
+    {
+        --_top;
+        _top->~value_type();
+        --_size;
+        if (_top == _segments[_segment] && _segment != 0)
+        {
+            --_segment;
+            _top = segment_end(_segment);
+        }
+    }
+
+    // Destroys the elements, keeps the segments
+    void clear() noexcept
+    {
+        drop_to(0, std::is_trivially_destructible<value_type>());
+    }
+
+    // Member Functions: Speculation
+    // The current top, to roll back to or commit later. Marks nest: a later mark sits at or above an earlier one.
+    mark_type mark() const noexcept
+    {
+        return mark_type(_size);
+    }
+
+    // Removes every element pushed since mark was taken
+    void rollback(const mark_type& mark)
+    {
+        check(mark);
+        drop_to(mark._size, std::is_trivially_destructible<value_type>());
+    }
+
+    // Keeps every element pushed since mark was taken. Nothing moves: the elements already sit where they
+    // belong, so committing only checks that mark is still valid. An enclosing mark still covers them.
+    void commit(const mark_type& mark) const
+    {
+        check(mark);
+    }
+
+    void swap(SegmentedStack& other) noexcept
+    {
+        using std::swap;
+        _segments.swap(other._segments);
+        swap(_segment, other._segment);
+        swap(_top, other._top);
+        swap(_size, other._size);
+    }
+
+    // Declare relational operators as friends - need access to the elements
+    template<class myStackDataType, size_t mySegmentSize>
+    friend bool operator==(const SegmentedStack<myStackDataType, mySegmentSize>& lhs,
+        const SegmentedStack<myStackDataType, mySegmentSize>& rhs);
+
+    template<class myStackDataType, size_t mySegmentSize>
+    friend bool operator<(const SegmentedStack<myStackDataType, mySegmentSize>& lhs,
+        const SegmentedStack<myStackDataType, mySegmentSize>& rhs);
+
+private:
+    // Every segment allocated, bottom first; those above _segment are spares
+    stlcontainer::Vector<value_type*> _segments;
+    size_type _segment;         // Segment holding the top element, or the first segment when empty
+    value_type* _top;           // One past the top element, nullptr before the first segment exists
+    size_type _size;
+
+    value_type* segment_end(size_type segment) const noexcept
+    {
+        return _segments[segment] + SegmentSize;
+    }
+
+    // Element at position index counted from the bottom
+    const value_type& element(size_type index) const noexcept
+    {
+        return _segments[index / SegmentSize][index % SegmentSize];
+    }
+
+    // Moves the top to the start of the next segment, reusing a spare one when there is one
+    void next_segment()
+    {
+        auto next = _top == nullptr ? 0 : _segment + 1;
+        if (next == _segments.size())
+        {
+            auto segment = static_cast<value_type*>(::operator new(SegmentSize * sizeof(value_type)));
+            try
+            {
+                _segments.push_back(segment);
+            }
+            catch (...)
+            {
+                ::operator delete(segment);
+                throw;
+            }
+        }
+        _segment = next;
+        _top = _segments[next];
+    }
+
+    // Frees the segments from first on, which must hold no elements
+    void release_segments(size_type first) noexcept
+    {
+        while (_segments.size() > first)
+        {
+            ::operator delete(_segments.back());
+            _segments.pop_back();
+        }
+    }
+
+    void check(const mark_type& mark) const
+    {
+        if (mark._size > _size)
+        {
+            throw std::invalid_argument("stlcontainer::SegmentedStack: mark lies above the top");
+        }
+    }
+
+    // Nothing to destroy: point the top at size and leave the segments above as spares
+    void drop_to(size_type size, std::true_type) noexcept
+    {
+        _size = size;
+        if (_top == nullptr)
+        {
+            return;
+        }
+        _segment = size == 0 ? 0 : (size - 1) / SegmentSize;
+        _top = _segments[_segment] + (size - _segment * SegmentSize);
+    }
+
+    void drop_to(size_type size, std::false_type) noexcept
+    {
+        while (_size > size)
+        {
+            pop();
+        }
+    }
+
+    void append_copies(const SegmentedStack& other)
+    {
+        for (size_type index = 0; index < other._size; ++index)
+        {
+            push(other.element(index));
+        }
+    }
+};
+
+// Non-Member Functions: Relational Operators
+template<class StackDataType, size_t SegmentSize>
+bool operator==(const SegmentedStack<StackDataType, SegmentSize>& lhs,
+    const SegmentedStack<StackDataType, SegmentSize>& rhs)
+{
+    if (lhs._size != rhs._size)
+    {
+        return false;
+    }
+    for (size_t index = 0; index < lhs._size; ++index)
+    {
+        if (!(lhs.element(index) == rhs.element(index)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class StackDataType, size_t SegmentSize>
+bool operator!=(const SegmentedStack<StackDataType, SegmentSize>& lhs,
+    const SegmentedStack<StackDataType, SegmentSize>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<class StackDataType, size_t SegmentSize>
+bool operator<(const SegmentedStack<StackDataType, SegmentSize>& lhs,
+    const SegmentedStack<StackDataType, SegmentSize>& rhs)
+{
+    auto common = std::min(lhs._size, rhs._size);
+    for (size_t index = 0; index < common; ++index)
+    {
+        if (lhs.element(index) < rhs.element(index))
+        {
+            return true;
+        }
+        if (rhs.element(index) < lhs.element(index))
+        {
+            return false;
+        }
+    }
+    return lhs._size < rhs._size;
+}
+
+template<class StackDataType, size_t SegmentSize>
+bool operator>(const SegmentedStack<StackDataType, SegmentSize>& lhs,
+    const SegmentedStack<StackDataType, SegmentSize>& rhs)
+{
+    return rhs < lhs;
+}
+
+template<class StackDataType, size_t SegmentSize>
+bool operator<=(const SegmentedStack<StackDataType, SegmentSize>& lhs,
+    const SegmentedStack<StackDataType, SegmentSize>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template<class StackDataType, size_t SegmentSize>
+bool operator>=(const SegmentedStack<StackDataType, SegmentSize>& lhs,
+    const SegmentedStack<StackDataType, SegmentSize>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// Non-Member Functions: Swap
+template<class StackDataType, size_t SegmentSize>
+void swap(SegmentedStack<StackDataType, SegmentSize>& lhs, SegmentedStack<StackDataType, SegmentSize>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
@@ -1,11 +1,20 @@
+#pragma once
 #include "stddef.h"
 
-#include <deque>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "vector/Vector.h"
 
 namespace stlcontainer 
 {
 
-template<typename StackDataType, typename Container = std::deque<StackDataType>> 
+// Contiguous storage by default: a stack only ever grows and shrinks at one end, and stlcontainer::Vector does
+// that without the per-block bookkeeping of std::deque. Any container with back, push_back, pop_back,
+// emplace_back, empty and size works.
+template<typename StackDataType, typename Container = stlcontainer::Vector<StackDataType>> 
 class Stack
 {
 public:
@@ -31,30 +40,35 @@ public:
     Stack(const Stack& other): _container(other._container) {};
 
     // Move constructor
-    Stack(Stack&& other): _container(std::move(other._container)) {};
+    Stack(Stack&& other) noexcept(std::is_nothrow_move_constructible<Container>::value)
+        : _container(std::move(other._container)) {};
 
     // Member Functions: Destructor
     ~Stack() = default;
 
     // Member Functions: Assignment Operator
-    Stack& operator=(const Container& other)
+    Stack& operator=(const Stack& other) noexcept(std::is_nothrow_copy_assignable<Container>::value)
     {
-        if (this != &other) 
-        {
-            _container = other._container;
-        }
+        _container = other._container;
         return *this;
     }
 
-    Stack& operator=(Container&& other)
+    Stack& operator=(Stack&& other) noexcept(std::is_nothrow_move_assignable<Container>::value)
     {
-        if (this != &other)
-        {
-            delete[] _container;
-            _container = std::move(other._container);
-            other._container = nullptr;
-        }
-        return *this;  
+        _container = std::move(other._container);
+        return *this;
+    }
+
+    Stack& operator=(const Container& other) noexcept(std::is_nothrow_copy_assignable<Container>::value)
+    {
+        _container = other;
+        return *this;
+    }
+
+    Stack& operator=(Container&& other) noexcept(std::is_nothrow_move_assignable<Container>::value)
+    {
+        _container = std::move(other);
+        return *this;
     }
 
     // Member Functions: Element Access
@@ -79,6 +93,12 @@ public:
         return _container.size();
     }
 
+    // Makes room for count elements in total when the container can reserve, does nothing otherwise
+    void reserve(size_type count)
+    {
+        reserve(count, 0);
+    }
+
     // Member Functions: Modifiers
     void push(const value_type& value)
     {
@@ -90,11 +110,42 @@ public:
         _container.push_back(std::move(value));
     }
 
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        _container.emplace_back(std::forward<Args>(args)...);
+    }
+
     void pop()
     {
         _container.pop_back();
     }
 
+    // Pushes [first, last) in order, so *(last - 1) ends up on top. When the length is known up front the
+    // container grows at most once.
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last)
+    {
+        make_room(first, last, typename std::iterator_traits<InputIterator>::iterator_category(), 0);
+        for (; first != last; ++first)
+        {
+            _container.push_back(*first);
+        }
+    }
+
+    // Moves up to max_n elements, top first, into out and removes them. Returns how many.
+    template<typename OutputIterator>
+    size_type pop_n(OutputIterator out, size_type max_n)
+    {
+        auto count = std::min(max_n, _container.size());
+        for (size_type index = 0; index < count; ++index, ++out)
+        {
+            *out = std::move(_container.back());
+            _container.pop_back();
+        }
+        return count;
+    }
+
     void swap(Stack& other) noexcept
     {
         std::swap(_container, other._container);
@@ -123,6 +174,37 @@ public:
 
 protected:
     Container _container;    
+
+private:
+    // Overloads ranked by their last argument: int beats long, and SFINAE drops the first for containers
+    // without reserve. Cont defers the check to the call so it can fail softly.
+    template<typename Cont = Container>
+    auto reserve(size_type count, int) -> decltype(std::declval<Cont&>().reserve(count), void())
+    {
+        _container.reserve(count);
+    }
+
+    void reserve(size_type, long)
+    {
+    }
+
+    // Grows geometrically even when called with many small ranges, exact reserves would reallocate every time.
+    // Only ranges that can be measured without consuming them, and only containers that report a capacity.
+    template<typename ForwardIterator, typename Cont = Container>
+    auto make_room(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag, int)
+        -> decltype(std::declval<Cont&>().capacity(), void())
+    {
+        auto needed = _container.size() + static_cast<size_type>(std::distance(first, last));
+        if (needed > _container.capacity())
+        {
+            reserve(std::max(needed, 2 * _container.capacity()));
+        }
+    }
+
+    template<typename InputIterator>
+    void make_room(InputIterator, InputIterator, std::input_iterator_tag, long)
+    {
+    }
 };
 
 // Non-Member Functions: Relational Operators
@@ -0,0 +1,360 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "stack/StaticStackOverflowPolicy.h"
+
+namespace stlcontainer
+{
+
+// A stack whose first N elements live in an inline buffer inside the object, for depths known up front:
+// a DFS over a graph of bounded depth, a recursive-descent parser, an undo buffer. Nothing is allocated
+// while the depth stays within N. OverflowPolicy decides what a push beyond that does, see
+// StaticStackOverflowPolicy.h. try_push and try_emplace never overflow: they return false instead.
+template<typename StackDataType, size_t N, typename OverflowPolicy = StaticStackThrowOnOverflow<StackDataType>>
+class StaticStack : private OverflowPolicy
+{
+    static_assert(N > 0, "StaticStack needs an inline capacity of at least one element");
+
+public:
+    // Type definitions
+    using value_type =      StackDataType;
+    using size_type =       size_t;
+    using reference =       value_type&;
+    using const_reference = const value_type&;
+    using overflow_policy = OverflowPolicy;
+
+public:
+    // Member Functions: Constructors
+    // Default constructor, allocates nothing
+    StaticStack() noexcept : _size(0) {}
+
+    // Copy constructor
+    StaticStack(const StaticStack& other) : OverflowPolicy(), _size(0)
+    {
+        reserve(other._size);
+        append_copies(other.data(), other.data() + other._size);
+    }
+
+    // Move constructor. Takes over a heap block outright, moves the elements one by one otherwise.
+    StaticStack(StaticStack&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+        : OverflowPolicy(), _size(0)
+    {
+        take_elements(other);
+    }
+
+    // Member Functions: Destructor
+    ~StaticStack()
+    {
+        clear();
+        this->release();
+    }
+
+    // Member Functions: Assignment Operator
+    StaticStack& operator=(const StaticStack& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other._size);
+            append_copies(other.data(), other.data() + other._size);
+        }
+        return *this;
+    }
+
+    StaticStack& operator=(StaticStack&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+            take_elements(other);
+        }
+        return *this;
+    }
+
+    // Member Functions: Element Access
+    reference top()
+    {
+        return data()[_size - 1];
+    }
+
+    const_reference top() const
+    {
+        return data()[_size - 1];
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    size_type size() const noexcept
+    {
+        return _size;
+    }
+
+    // N until the stack spills, the size of its heap block after that
+    size_type capacity() const noexcept
+    {
+        return this->heap_data() != nullptr ? this->heap_capacity() : N;
+    }
+
+    static constexpr size_type inline_capacity() noexcept
+    {
+        return N;
+    }
+
+    // True once the elements have moved to the heap. Never true with StaticStackThrowOnOverflow.
+    bool spilled() const noexcept
+    {
+        return this->heap_data() != nullptr;
+    }
+
+    // Makes room for count elements in total. Beyond capacity() this is an overflow: it spills or throws
+    // std::length_error, as the policy decides.
+    void reserve(size_type count)
+    {
+        if (count > capacity())
+        {
+            this->grow(data(), _size, count);
+        }
+    }
+
+    // Member Functions: Modifiers
+    void push(const value_type& value)
+    {
+        emplace(value);
+    }
+
+    void push(value_type&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        auto elements = data();
+        if (_size < capacity())
+        {
+            new (elements + _size) value_type(std::forward<Args>(args)...);
+        }
+        else
+        {
+            value_type value(std::forward<Args>(args)...);     // args may refer to an element that grow moves
+            elements = this->grow(elements, _size, _size + 1);
+            new (elements + _size) value_type(std::move(value));
+        }
+        ++_size;
+    }
+
+    // Pushes only if there is room in the current storage: never allocates and never throws for lack of
+    // space. Returns false, with value untouched, when the stack is full.
+    bool try_push(const value_type& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(value_type&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        if (_size == capacity())
+        {
+            return false;
+        }
+        new (data() + _size) value_type(std::forward<Args>(args)...);
+        ++_size;
+        return true;
+    }
+
+    // The stack must not be empty
+    void pop()
+    {
+        --_size;
+        data()[_size].~value_type();
+    }
+
+    // Destroys the elements. A stack that spilled keeps its heap block.
+    void clear() noexcept
+    {
+        auto elements = data();
+        for (; _size != 0; --_size)
+        {
+            elements[_size - 1].~value_type();
+        }
+    }
+
+    // Pushes [first, last) in order, so *(last - 1) ends up on top. A range that can be measured is checked
+    // against the capacity up front: it overflows once, before anything is pushed.
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last)
+    {
+        push_range(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+    }
+
+    // Moves up to max_n elements, top first, into out and removes them. Returns how many.
+    template<typename OutputIterator>
+    size_type pop_n(OutputIterator out, size_type max_n)
+    {
+        auto count = std::min(max_n, _size);
+        auto elements = data();
+        for (size_type index = 0; index < count; ++index, ++out)
+        {
+            *out = std::move(elements[_size - 1]);
+            pop();
+        }
+        return count;
+    }
+
+    // Elements sit inside the object, so swapping moves them: linear in the inline sizes
+    void swap(StaticStack& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+    {
+        StaticStack temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    // Declare relational operators as friends - need access to the elements
+    template<class myStackDataType, size_t myN, class myOverflowPolicy>
+    friend bool operator==(const StaticStack<myStackDataType, myN, myOverflowPolicy>& lhs,
+        const StaticStack<myStackDataType, myN, myOverflowPolicy>& rhs);
+
+    template<class myStackDataType, size_t myN, class myOverflowPolicy>
+    friend bool operator<(const StaticStack<myStackDataType, myN, myOverflowPolicy>& lhs,
+        const StaticStack<myStackDataType, myN, myOverflowPolicy>& rhs);
+
+private:
+    using slot_type = typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type;
+
+    slot_type _buffer[N];
+    size_type _size;
+
+    // Bottom element, in the inline buffer or the heap block
+    value_type* data() noexcept
+    {
+        auto heap = this->heap_data();
+        return heap != nullptr ? heap : reinterpret_cast<value_type*>(_buffer);
+    }
+
+    const value_type* data() const noexcept
+    {
+        auto heap = this->heap_data();
+        return heap != nullptr ? heap : reinterpret_cast<const value_type*>(_buffer);
+    }
+
+    // Capacity must already suffice
+    template<typename InputIterator>
+    void append_copies(InputIterator first, InputIterator last)
+    {
+        auto elements = data();
+        for (; first != last; ++first, ++_size)
+        {
+            new (elements + _size) value_type(*first);
+        }
+    }
+
+    // This stack must be empty. Leaves other empty.
+    void take_elements(StaticStack& other)
+    {
+        if (other.spilled())
+        {
+            this->release();
+            this->take_heap(other);
+            _size = other._size;
+            other._size = 0;
+            return;
+        }
+        auto source = other.data();
+        auto target = data();
+        for (; _size < other._size; ++_size)
+        {
+            new (target + _size) value_type(std::move(source[_size]));
+        }
+        other.clear();
+    }
+
+    template<typename ForwardIterator>
+    void push_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+    {
+        auto needed = _size + static_cast<size_type>(std::distance(first, last));
+        if (needed > capacity())
+        {
+            this->grow(data(), _size, std::max(needed, 2 * capacity()));
+        }
+        append_copies(first, last);
+    }
+
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last, std::input_iterator_tag)
+    {
+        for (; first != last; ++first)
+        {
+            emplace(*first);
+        }
+    }
+};
+
+// Non-Member Functions: Relational Operators
+template<class StackDataType, size_t N, class OverflowPolicy>
+bool operator==(const StaticStack<StackDataType, N, OverflowPolicy>& lhs,
+    const StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+{
+    return lhs._size == rhs._size && std::equal(lhs.data(), lhs.data() + lhs._size, rhs.data());
+}
+
+template<class StackDataType, size_t N, class OverflowPolicy>
+bool operator!=(const StaticStack<StackDataType, N, OverflowPolicy>& lhs,
+    const StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<class StackDataType, size_t N, class OverflowPolicy>
+bool operator<(const StaticStack<StackDataType, N, OverflowPolicy>& lhs,
+    const StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+{
+    return std::lexicographical_compare(lhs.data(), lhs.data() + lhs._size, rhs.data(), rhs.data() + rhs._size);
+}
+
+template<class StackDataType, size_t N, class OverflowPolicy>
+bool operator>(const StaticStack<StackDataType, N, OverflowPolicy>& lhs,
+    const StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+{
+    return rhs < lhs;
+}
+
+template<class StackDataType, size_t N, class OverflowPolicy>
+bool operator<=(const StaticStack<StackDataType, N, OverflowPolicy>& lhs,
+    const StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template<class StackDataType, size_t N, class OverflowPolicy>
+bool operator>=(const StaticStack<StackDataType, N, OverflowPolicy>& lhs,
+    const StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// Non-Member Functions: Swap
+template<class StackDataType, size_t N, class OverflowPolicy>
+void swap(StaticStack<StackDataType, N, OverflowPolicy>& lhs, StaticStack<StackDataType, N, OverflowPolicy>& rhs)
+    noexcept(noexcept(lhs.swap(rhs)))
+{
+    lhs.swap(rhs);
+}
+
+} // namespace stlcontainer
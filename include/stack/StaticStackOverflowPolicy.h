@@ -0,0 +1,108 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace stlcontainer
+{
+
+// Overflow policies for StaticStack: what a push does when every slot of the current storage is taken. The
+// stack derives from its policy. try_push never consults it: it returns false instead and never allocates.
+
+// Default: the inline buffer is all there is. A push beyond it throws std::length_error and leaves the
+// stack unchanged.
+template<typename T>
+class StaticStackThrowOnOverflow
+{
+public:
+    static const bool spills = false;
+
+protected:
+    T* heap_data() const noexcept { return nullptr; }
+    size_t heap_capacity() const noexcept { return 0; }
+
+    T* grow(T*, size_t, size_t)
+    {
+        throw std::length_error("stlcontainer::StaticStack: inline capacity exceeded");
+    }
+
+    void release() noexcept {}
+    void take_heap(StaticStackThrowOnOverflow&) noexcept {}
+};
+
+// Once the inline buffer is full the whole stack moves to a heap block of twice the size, and keeps growing
+// there like a vector. It stays on the heap until it is destroyed, so a stack that spilled once does not
+// move back and forth around the inline capacity.
+template<typename T>
+class StaticStackSpillToHeap
+{
+public:
+    static const bool spills = true;
+
+    StaticStackSpillToHeap() noexcept = default;
+    StaticStackSpillToHeap(const StaticStackSpillToHeap&) noexcept {}
+    StaticStackSpillToHeap& operator=(const StaticStackSpillToHeap&) noexcept { return *this; }
+
+protected:
+    T* heap_data() const noexcept { return _heap; }
+    size_t heap_capacity() const noexcept { return _capacity; }
+
+    // Moves the size elements at data into a new heap block of at least min_capacity slots and returns it.
+    // Elements are moved when that cannot throw, copied otherwise, so a throw leaves data untouched.
+    T* grow(T* data, size_t size, size_t min_capacity)
+    {
+        auto capacity = std::max(min_capacity, 2 * std::max<size_t>(size, 1));
+        auto block = static_cast<T*>(::operator new(capacity * sizeof(T)));
+        size_t moved = 0;
+        try
+        {
+            for (; moved < size; ++moved)
+            {
+                new (block + moved) T(std::move_if_noexcept(data[moved]));
+            }
+        }
+        catch (...)
+        {
+            for (size_t index = 0; index < moved; ++index)
+            {
+                block[index].~T();
+            }
+            ::operator delete(block);
+            throw;
+        }
+        for (size_t index = 0; index < size; ++index)
+        {
+            data[index].~T();
+        }
+        ::operator delete(_heap);
+        _heap = block;
+        _capacity = capacity;
+        return block;
+    }
+
+    // The stack has destroyed the elements already
+    void release() noexcept
+    {
+        ::operator delete(_heap);
+        _heap = nullptr;
+        _capacity = 0;
+    }
+
+    // Takes over other's heap block, elements included, leaving other without one
+    void take_heap(StaticStackSpillToHeap& other) noexcept
+    {
+        _heap = other._heap;
+        _capacity = other._capacity;
+        other._heap = nullptr;
+        other._capacity = 0;
+    }
+
+private:
+    T* _heap = nullptr;
+    size_t _capacity = 0;
+};
+
+} // namespace stlcontainer
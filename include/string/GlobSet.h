@@ -0,0 +1,322 @@
+#pragma once
+#include "stddef.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <vector>
+
+#include "String.h"
+
+namespace stlcontainer
+{
+
+// Matches a String against many glob ('*' any run of chars, '?' exactly one char) and literal prefix
+// patterns in a single pass over the input. All patterns are merged into one NFA, which is turned into
+// a DFA lazily: each set of NFA states reached while matching becomes a cached DFA state with a 256-entry
+// transition row, so after warm-up every input character costs one table lookup regardless of pattern count.
+// Matching mutates the cache, so a GlobSet must not be matched from several threads at once.
+class GlobSet
+{
+public:
+    using pattern_id = size_t;
+
+    static const size_t DEFAULT_MAX_STATES = 4096;
+
+public:
+    // Member Functions: Constructors
+    // Default constructor
+    explicit GlobSet(size_t max_states = DEFAULT_MAX_STATES) : _max_states(max_states < 4 ? 4 : max_states) {};
+
+    // Initializer list constructor, globs get ids in list order
+    GlobSet(std::initializer_list<const char*> globs) : GlobSet()
+    {
+        for (auto glob : globs)
+        {
+            add_glob(glob);
+        }
+    }
+
+    // Member Functions: Modifiers
+    // Add glob pattern, returns id reported by match()
+    pattern_id add_glob(const String& glob)
+    {
+        return add_glob(glob.data(), glob.size());
+    }
+
+    pattern_id add_glob(const char* s)
+    {
+        return add_glob(s, cstr_len(s));
+    }
+
+    pattern_id add_glob(const char* s, size_t count)
+    {
+        auto id = _pattern_count++;
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (s[index] == '*')
+            {
+                // Runs of '*' are equivalent to a single one
+                if (_nfa.empty() || _nfa.back().kind != STAR)
+                {
+                    push_step(STAR, 0, id);
+                }
+            }
+            else
+            {
+                push_step(s[index] == '?' ? ANY : LITERAL, s[index], id);
+            }
+        }
+        push_step(ACCEPT, 0, id);
+        return id;
+    }
+
+    // Add literal prefix, '*' and '?' in prefix are matched literally
+    pattern_id add_prefix(const String& prefix)
+    {
+        return add_prefix(prefix.data(), prefix.size());
+    }
+
+    pattern_id add_prefix(const char* s)
+    {
+        return add_prefix(s, cstr_len(s));
+    }
+
+    pattern_id add_prefix(const char* s, size_t count)
+    {
+        auto id = _pattern_count++;
+        for (size_t index = 0; index < count; ++index)
+        {
+            push_step(LITERAL, s[index], id);
+        }
+        push_step(STAR, 0, id);
+        push_step(ACCEPT, 0, id);
+        return id;
+    }
+
+    void clear() noexcept
+    {
+        _nfa.clear();
+        _pattern_starts.clear();
+        _pattern_count = 0;
+        reset_cache();
+    }
+
+    // Member Functions: Capacity
+    bool empty() const noexcept
+    {
+        return _pattern_count == 0;
+    }
+
+    size_t size() const noexcept
+    {
+        return _pattern_count;
+    }
+
+    // Number of DFA states built so far, useful to size max_states
+    size_t cached_states() const noexcept
+    {
+        return _dfa_sets.size();
+    }
+
+    // Member Functions: Matching
+    // Ids of all patterns matching the whole input, in ascending order
+    std::vector<pattern_id> match(const String& str) const
+    {
+        return match(str.data(), str.size());
+    }
+
+    std::vector<pattern_id> match(const char* s) const
+    {
+        return match(s, cstr_len(s));
+    }
+
+    std::vector<pattern_id> match(const char* s, size_t count) const
+    {
+        std::vector<pattern_id> out;
+        match(s, count, out);
+        return out;
+    }
+
+    // Overwrites out, lets callers reuse one buffer across many inputs
+    void match(const char* s, size_t count, std::vector<pattern_id>& out) const
+    {
+        out.clear();
+        auto state = run(s, count);
+        out.insert(out.end(), _dfa_accepts[state].begin(), _dfa_accepts[state].end());
+    }
+
+    bool matches_any(const String& str) const
+    {
+        return matches_any(str.data(), str.size());
+    }
+
+    bool matches_any(const char* s) const
+    {
+        return matches_any(s, cstr_len(s));
+    }
+
+    bool matches_any(const char* s, size_t count) const
+    {
+        return !_dfa_accepts[run(s, count)].empty();
+    }
+
+private:
+    enum StepKind : uint8_t { LITERAL, ANY, STAR, ACCEPT };
+
+    struct Step
+    {
+        StepKind kind;
+        char ch;
+        pattern_id pattern;
+    };
+
+    using state_set = std::vector<uint32_t>;
+
+    static const uint32_t DEAD_STATE = 0;
+    static const uint32_t UNKNOWN_STATE = UINT32_MAX;
+    static const size_t ALPHABET_SIZE = 256;
+
+    std::vector<Step> _nfa;                     // Patterns laid out back to back, each ends in ACCEPT
+    std::vector<uint32_t> _pattern_starts;      // First NFA step of each pattern
+    size_t _pattern_count = 0;
+    size_t _max_states;
+
+    // Lazily built DFA, _dfa_sets[0] is the empty (dead) set
+    mutable std::map<state_set, uint32_t> _dfa_index;
+    mutable std::vector<state_set> _dfa_sets;
+    mutable std::vector<std::vector<pattern_id>> _dfa_accepts;
+    mutable std::vector<uint32_t> _transitions;  // ALPHABET_SIZE entries per DFA state
+    mutable uint32_t _start = UNKNOWN_STATE;
+
+    void push_step(StepKind kind, char ch, pattern_id id)
+    {
+        if (_pattern_starts.size() <= id)
+        {
+            _pattern_starts.push_back(static_cast<uint32_t>(_nfa.size()));
+        }
+        _nfa.push_back(Step{kind, ch, id});
+        reset_cache();
+    }
+
+    void reset_cache() const
+    {
+        _dfa_index.clear();
+        _dfa_sets.clear();
+        _dfa_accepts.clear();
+        _transitions.clear();
+        _start = UNKNOWN_STATE;
+    }
+
+    // Adds step and everything reachable from it without consuming input
+    void add_closure(uint32_t step, state_set& set) const
+    {
+        set.push_back(step);
+        if (_nfa[step].kind == STAR)
+        {
+            set.push_back(step + 1);   // A star is always followed by a non-star step
+        }
+    }
+
+    static void normalize(state_set& set)
+    {
+        std::sort(set.begin(), set.end());
+        set.erase(std::unique(set.begin(), set.end()), set.end());
+    }
+
+    // Set must be normalized
+    uint32_t intern(const state_set& set) const
+    {
+        auto found = _dfa_index.find(set);
+        if (found != _dfa_index.end())
+        {
+            return found->second;
+        }
+
+        auto id = static_cast<uint32_t>(_dfa_sets.size());
+        std::vector<pattern_id> accepts;
+        for (auto step : set)
+        {
+            if (_nfa[step].kind == ACCEPT)
+            {
+                accepts.push_back(_nfa[step].pattern);
+            }
+        }
+        _dfa_index.emplace(set, id);
+        _dfa_sets.push_back(set);
+        _dfa_accepts.push_back(std::move(accepts));
+        uint32_t fill = UNKNOWN_STATE;
+        if (id == DEAD_STATE)
+        {
+            fill = DEAD_STATE;   // The dead state never leaves itself
+        }
+        _transitions.resize(_transitions.size() + ALPHABET_SIZE, fill);
+        return id;
+    }
+
+    void build_start() const
+    {
+        state_set dead;
+        intern(dead);
+
+        state_set start;
+        for (auto step : _pattern_starts)
+        {
+            add_closure(step, start);
+        }
+        normalize(start);
+        _start = intern(start);
+    }
+
+    uint32_t build_transition(uint32_t from, unsigned char ch) const
+    {
+        state_set next;
+        for (auto step : _dfa_sets[from])
+        {
+            const auto& curr = _nfa[step];
+            if (curr.kind == STAR)
+            {
+                add_closure(step, next);
+            }
+            else if (curr.kind == ANY || (curr.kind == LITERAL && static_cast<unsigned char>(curr.ch) == ch))
+            {
+                add_closure(step + 1, next);
+            }
+        }
+
+        normalize(next);
+
+        if (_dfa_sets.size() >= _max_states && _dfa_index.find(next) == _dfa_index.end())
+        {
+            // Cache full: start over, keeping only the dead, start and current state
+            auto from_set = _dfa_sets[from];
+            reset_cache();
+            build_start();
+            from = intern(from_set);
+        }
+
+        auto to = intern(next);
+        _transitions[from * ALPHABET_SIZE + ch] = to;
+        return to;
+    }
+
+    uint32_t run(const char* s, size_t count) const
+    {
+        if (_start == UNKNOWN_STATE)
+        {
+            build_start();
+        }
+
+        auto state = _start;
+        for (size_t index = 0; index < count && state != DEAD_STATE; ++index)
+        {
+            auto ch = static_cast<unsigned char>(s[index]);
+            auto next = _transitions[state * ALPHABET_SIZE + ch];
+            state = next != UNKNOWN_STATE ? next : build_transition(state, ch);
+        }
+        return state;
+    }
+};
+
+} // namespace stlcontainer
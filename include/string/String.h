@@ -1,5 +1,7 @@
+#pragma once
 #include "stddef.h"
 
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <iostream>
@@ -7,7 +9,7 @@
 namespace stlcontainer
 {
 
-size_t cstr_len(const char* s)
+inline size_t cstr_len(const char* s)
 {
     size_t length = 0;
     while (*s++)
@@ -840,15 +842,107 @@ public:
 
     // Member Functions: Search
     // Substring find
-    size_t find(const String& str, size_t pos = 0) const noexcept {}
+    size_t find(const String& str, size_t pos = 0) const noexcept 
+    {
+        return find_buffer(str.data(), str.size(), pos);
+    }
+
     // Range find
-    size_t find(const char* s, size_t pos, size_t count) const {}
+    size_t find(const char* s, size_t pos, size_t count) const 
+    {
+        return find_buffer(s, count, pos);
+    }
+
     // C-str find
-    size_t find(const char* s, size_t pos = 0) const {}
+    size_t find(const char* s, size_t pos = 0) const 
+    {
+        return find_buffer(s, cstr_len(s), pos);
+    }
+
     // Char find
-    size_t find(char ch, size_t pos = 0) const noexcept {}
+    size_t find(char ch, size_t pos = 0) const noexcept 
+    {
+        if (pos >= size())
+        {
+            return stlcontainer::String::npos;
+        }
+        auto found = static_cast<const char*>(std::memchr(_str + pos, ch, size() - pos));
+        return found ? static_cast<size_t>(found - _str) : stlcontainer::String::npos;
+    }
     // TODO Stringview find
 
+    // String starts_with
+    bool starts_with(const String& str) const noexcept
+    {
+        return starts_with(str.data(), str.size());
+    }
+
+    // C-str starts_with
+    bool starts_with(const char* s) const
+    {
+        return starts_with(s, cstr_len(s));
+    }
+
+    // Buffer starts_with
+    bool starts_with(const char* s, size_t count) const noexcept
+    {
+        return count <= size() && (count == 0 || std::memcmp(_str, s, count) == 0);
+    }
+
+    // Char starts_with
+    bool starts_with(char ch) const noexcept
+    {
+        return !empty() && front() == ch;
+    }
+
+    // String ends_with
+    bool ends_with(const String& str) const noexcept
+    {
+        return ends_with(str.data(), str.size());
+    }
+
+    // C-str ends_with
+    bool ends_with(const char* s) const
+    {
+        return ends_with(s, cstr_len(s));
+    }
+
+    // Buffer ends_with
+    bool ends_with(const char* s, size_t count) const noexcept
+    {
+        return count <= size() && (count == 0 || std::memcmp(_str + size() - count, s, count) == 0);
+    }
+
+    // Char ends_with
+    bool ends_with(char ch) const noexcept
+    {
+        return !empty() && back() == ch;
+    }
+
+    // String contains
+    bool contains(const String& str) const noexcept
+    {
+        return find(str) != stlcontainer::String::npos;
+    }
+
+    // C-str contains
+    bool contains(const char* s) const
+    {
+        return find(s) != stlcontainer::String::npos;
+    }
+
+    // Buffer contains
+    bool contains(const char* s, size_t count) const noexcept
+    {
+        return find_buffer(s, count, 0) != stlcontainer::String::npos;
+    }
+
+    // Char contains
+    bool contains(char ch) const noexcept
+    {
+        return find(ch) != stlcontainer::String::npos;
+    }
+
     // TODO rfind
     // TODO find_*_of variations
 
@@ -856,22 +950,52 @@ private:
     char *_str;
     size_t _len;
     size_t _capacity;
+
+    // Scan for the first character with memchr, only compare the full needle at candidate positions
+    size_t find_buffer(const char* s, size_t count, size_t pos) const noexcept
+    {
+        if (pos > size() || count > size() - pos)
+        {
+            return stlcontainer::String::npos;
+        }
+        if (count == 0)
+        {
+            return pos;
+        }
+
+        const char* curr = _str + pos;
+        const char* last = _str + size() - count;   // Last position a match can start at
+        while (curr <= last)
+        {
+            curr = static_cast<const char*>(std::memchr(curr, *s, last - curr + 1));
+            if (!curr)
+            {
+                break;
+            }
+            if (std::memcmp(curr + 1, s + 1, count - 1) == 0)
+            {
+                return curr - _str;
+            }
+            ++curr;
+        }
+        return stlcontainer::String::npos;
+    }
 };
 
 // Non-Member Functions: Concatenation
-String operator+ (const String& lhs, const String& rhs) 
+inline String operator+ (const String& lhs, const String& rhs) 
 {
     String out(lhs);
     return out.append(rhs);
 }
 
-String operator+ (const String& lhs, const char* rhs)
+inline String operator+ (const String& lhs, const char* rhs)
 {
     String out(lhs);
     return out.append(rhs);
 }
 
-String operator+ (const String& lhs, char rhs)
+inline String operator+ (const String& lhs, char rhs)
 {
     String out(lhs);
     out.push_back(rhs);
@@ -879,7 +1003,7 @@ String operator+ (const String& lhs, char rhs)
 }
 
 // Non-Member Functions: Relational Operators
-bool operator== (const String& lhs, const String& rhs)
+inline bool operator== (const String& lhs, const String& rhs)
 {
     if (lhs.size() != rhs.size())
     {
@@ -896,12 +1020,12 @@ bool operator== (const String& lhs, const String& rhs)
     return true;
 }
 
-bool operator!= (const String& lhs, const String& rhs)
+inline bool operator!= (const String& lhs, const String& rhs)
 {
     return !(lhs == rhs);
 }
 
-bool operator<(const String& lhs, const String& rhs) 
+inline bool operator<(const String& lhs, const String& rhs) 
 {
     bool matchingElems = true;
     for(auto index = 0; index < std::min(lhs.size(), rhs.size()); ++index)
@@ -924,36 +1048,36 @@ bool operator<(const String& lhs, const String& rhs)
     return true; 
 }
 
-bool operator> (const String& lhs, const String& rhs)
+inline bool operator> (const String& lhs, const String& rhs)
 {
     return rhs < lhs;
 }
 
-bool operator<= (const String& lhs, const String& rhs)
+inline bool operator<= (const String& lhs, const String& rhs)
 {
     return !(rhs < lhs);
 }
 
-bool operator>= (const String& lhs, const String& rhs)
+inline bool operator>= (const String& lhs, const String& rhs)
 {
     return !(lhs < rhs);
 }
 
 // Non-Member Functions: Input/Output
-std::ostream& operator<<(std::ostream& os, const stlcontainer::String& str)
+inline std::ostream& operator<<(std::ostream& os, const stlcontainer::String& str)
 {
     os << str.c_str();
     return os;
 }
 
-std::ostream& operator>>(std::ostream& os, const stlcontainer::String& str)
+inline std::ostream& operator>>(std::ostream& os, const stlcontainer::String& str)
 {
     os >> str.c_str();
     return os;
 }
 
 // Non-Member Functions: Swap
-void swap(String& lhs, String& rhs) noexcept
+inline void swap(String& lhs, String& rhs) noexcept
 {
     lhs.swap(rhs);
 }
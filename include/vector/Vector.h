@@ -1,4 +1,12 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
 #include "vector/VectorIterator.h"
 
@@ -12,43 +20,42 @@ namespace stlcontainer {
     public:
         // Type definitions
         using value_type = VectorDataType;
+        using size_type = size_t;
         using reference = value_type&;
         using pointer = value_type*;
         using const_reference = const value_type&;
         using const_pointer = const value_type*;
-        using difference_type = value_type;
+        using difference_type = std::ptrdiff_t;
         using iterator = stlcontainer::VectorIterator<Vector<VectorDataType>>;
         using const_iterator = const stlcontainer::VectorIterator<Vector<VectorDataType>>;
         using VectorIterType = stlcontainer::VectorIterator<Vector<VectorDataType>>;
     
     public:
         // Constructors
-        // Fill constructor
-        explicit Vector(size_t count = 0, const VectorDataType& value = value_type{}): _count(0), _capacity(0) 
+        // Default constructor, allocates nothing
+        Vector() noexcept: _elements(nullptr), _count(0), _capacity(0) {}
+
+        // Fill constructor. Storage is raw memory: only the first _count slots hold constructed elements.
+        explicit Vector(size_t count, const VectorDataType& value = value_type{}): _elements(nullptr), _count(0), _capacity(0) 
         {
-            reserve( count == 0 ? 1 : count);
-            for (auto index = 0; index < count; ++index )
+            reserve(count);
+            for (; _count < count; ++_count)
             {
-                _elements[index] = value;
+                new (_elements + _count) value_type(value);
             }
-            _count = count;
         }
 
         // TODO Range constructor
 
         // Copy constructor
-        Vector(const Vector<VectorDataType> &other): _count(0), _capacity(0)
+        Vector(const Vector<VectorDataType> &other): _elements(nullptr), _count(0), _capacity(0)
         {
-            reserve(other._capacity);  
-            for (auto index = 0; index != other._capacity; ++index)
-            {
-                _elements[index] = other._elements[index];
-            }
-            _count = other._count;
+            reserve(other._count);
+            append_copies(other._elements, other._elements + other._count);
         }
 
         // Move constructor
-        Vector(Vector<VectorDataType> &&other): _count{std::move(other._count)}, _capacity{std::move(other._capacity)}, _elements{std::move(other._elements)}
+        Vector(Vector<VectorDataType> &&other) noexcept: _elements{other._elements}, _count{other._count}, _capacity{other._capacity}
         {
             other._elements = nullptr;
             other._count = 0;
@@ -56,16 +63,15 @@ namespace stlcontainer {
         }
 
         // Initializer list constructor
-        Vector(std::initializer_list<VectorDataType> initList ): _count(0), _capacity(0) 
+        Vector(std::initializer_list<VectorDataType> initList ): _elements(nullptr), _count(0), _capacity(0) 
         {
             reserve(initList.size());
-            std::uninitialized_copy(initList.begin(), initList.end(), _elements);
-            _count = initList.size();
+            append_copies(initList.begin(), initList.end());
         }
 
         // Destructor
         ~Vector() {
-            delete[] _elements;
+            clear();
         }
 
         // Copy assignment
@@ -73,12 +79,9 @@ namespace stlcontainer {
         {
             if (this != &other) 
             {
-                reserve(other._capacity);
-                for (auto index = 0; index != other.size(); ++index)
-                {
-                    _elements[index] = other._elements[index];
-                }
-                _count = other._count;
+                destroy_elements();
+                reserve(other._count);
+                append_copies(other._elements, other._elements + other._count);
             }
             return *this;
         }
@@ -88,7 +91,7 @@ namespace stlcontainer {
         {
             if (this != &other)
             {
-                delete[] _elements;
+                clear();
                 _elements = other._elements;
                 _count = other._count;
                 _capacity = other._capacity;
@@ -103,33 +106,27 @@ namespace stlcontainer {
         // Member functions
         Vector& operator=(std::initializer_list<VectorDataType> initList) 
         {
-            reserve(initList.size());
-
-            // Reassign data to initList
-            std::uninitialized_copy(initList.begin(), initList.end(), _elements);
-            _count = initList.size();
+            assign(initList);
+            return *this;
         }
 
         void assign(size_t count, const VectorDataType& value) 
         {
-            clear();
-
+            destroy_elements();
             reserve(count);
-            for (auto index = 0; index < count; ++index )
+            for (; _count < count; ++_count)
             {
-                _elements[index] = value;
+                new (_elements + _count) value_type(value);
             }
-            _count = count;
         }
 
         // TODO range assignment: void assign(VectorIterType firstIter, VectorIterType lastIter) 
 
         void assign(std::initializer_list<VectorDataType> initList) 
         {
-            clear(); 
+            destroy_elements();
             reserve(initList.size());
-            std::uninitialized_copy(initList.begin(), initList.end(), _elements);
-            _count = initList.size();
+            append_copies(initList.begin(), initList.end());
         }
 
         // Element access
@@ -184,6 +181,11 @@ namespace stlcontainer {
             return _elements;
         }
 
+        const VectorDataType* data() const noexcept 
+        { 
+            return _elements;
+        }
+
         // Iterators
         iterator create_iterator(value_type* start_elem, size_t pos) noexcept 
         {
@@ -197,22 +199,22 @@ namespace stlcontainer {
 
         iterator begin() noexcept 
         {
-            create_iterator(_elements, 0);
+            return create_iterator(_elements, 0);
         }
 
         const_iterator cbegin() noexcept 
         {
-            create_iterator(_elements, 0);
+            return create_iterator(_elements, 0);
         }
 
         iterator end() noexcept 
         {
-            create_iterator(_elements, _count);
+            return create_iterator(_elements, _count);
         }
 
         const_iterator cend() noexcept 
         {
-            create_iterator(_elements, _count);
+            return create_iterator(_elements, _count);
         }
 
         // Capacity
@@ -239,29 +241,38 @@ namespace stlcontainer {
                 return;
             }
 
-            // Else, increase capacity, copy elem to new data
-            VectorDataType *new_elem = new VectorDataType[new_capacity];
-
-            // Copy elements to new vector, _count stays the same 
-            if (size())
+            // Else, allocate raw storage and relocate the elements into it: moved when that cannot throw,
+            // copied otherwise so a throwing copy leaves this vector untouched
+            auto new_elem = static_cast<pointer>(::operator new(new_capacity * sizeof(value_type)));
+            size_t relocated = 0;
+            try
             {
-                for (size_t index = 0; index != size(); ++index)
+                for (; relocated != _count; ++relocated)
                 {
-                    new_elem[index] = _elements[index];
+                    new (new_elem + relocated) value_type(std::move_if_noexcept(_elements[relocated]));
                 }
-                delete[] _elements;
-            }    
+            }
+            catch (...)
+            {
+                destroy_range(new_elem, new_elem + relocated);
+                ::operator delete(new_elem);
+                throw;
+            }
 
+            destroy_range(_elements, _elements + _count);
+            ::operator delete(_elements);
             _capacity = new_capacity;
             _elements = new_elem;
         }
 
         // Modifiers
+        // Destroys the elements and releases the storage
         void clear() noexcept 
         {
-            delete[] _elements;
+            destroy_elements();
+            ::operator delete(_elements);
             _elements = nullptr;
-            _count = 0;
+            _capacity = 0;
         }
 
         // TODO iterator erase(const_iterator pos) {}
@@ -270,29 +281,39 @@ namespace stlcontainer {
 
         void push_back(const VectorDataType& val) 
         {
-            if (capacity() < size() + 1) 
-            {
-                reserve( size() == 0 ? 1 : capacity() * 2);
-            }
-            _elements[_count++] = val;
+            emplace_back(val);
         }
 
         void push_back(VectorDataType&& val) 
         {
-            if (capacity() < size() + 1) 
+            emplace_back(std::move(val));
+        }
+
+        // Constructs the new element before growing, so args may refer to an element of this vector
+        template<typename... Args>
+        reference emplace_back(Args&&... args) 
+        {
+            if (_count < _capacity)
+            {
+                new (_elements + _count) value_type(std::forward<Args>(args)...);
+            }
+            else
             {
-                reserve( size() == 0 ? 1 : capacity() * 2);
+                value_type val(std::forward<Args>(args)...);
+                reserve(_capacity == 0 ? 1 : _capacity * 2);
+                new (_elements + _count) value_type(std::move(val));
             }
-            _elements[_count++] = val;
+            return _elements[_count++];
         }
 
+        // Removing from an empty vector does nothing
         void pop_back() 
         {
             if (!empty())
             {
                 --_count;
+                _elements[_count].~VectorDataType();
             }
-            _elements[_count].~VectorDataType();
         }
 
         void resize(size_t count) 
@@ -300,23 +321,18 @@ namespace stlcontainer {
             if (count == size()) return;
 
             // Reduce vector to first count elements
-            if (count < size())
+            while (count < size())
             {
-                for (auto index = size() - 1; index >= count; --index)
-                {
-                    _elements[index].~VectorDataType();
-                    --_count;
-                }
+                pop_back();
             }
 
             // Default insert count - size() elements
             if (count > size())
             {
                 reserve(count + 1);
-                for (auto index = size(); index < count; ++index)
+                for (; _count < count; ++_count)
                 {
-                    _elements[index] = VectorDataType();     // Default initialization
-                    ++_count;
+                    new (_elements + _count) value_type();     // Value initialization
                 }
             }
         }
@@ -326,23 +342,19 @@ namespace stlcontainer {
             if (count == size()) return;
 
             // Reduce vector to first count elements
-            if (count < size())
+            while (count < size())
             {
-                for (auto index = size() - 1; index >= count; --index)
-                {
-                    _elements[index].~VectorDataType();
-                    --_count;
-                }
+                pop_back();
             }
 
             // Insert count - size() elements with val value
             if (count > size())
             {
+                value_type copy(val);       // val may be an element that reserve is about to move
                 reserve(count + 1);
-                for (auto index = size(); index < count; ++index)
+                for (; _count < count; ++_count)
                 {
-                    _elements[index] = val;
-                    ++_count;
+                    new (_elements + _count) value_type(copy);
                 }
             }
         }
@@ -359,6 +371,31 @@ namespace stlcontainer {
         value_type* _elements;
         size_t _count;
         size_t _capacity;
+
+        static void destroy_range(pointer first, pointer last) noexcept
+        {
+            for (; first != last; ++first)
+            {
+                first->~value_type();
+            }
+        }
+
+        // Destroys the elements, keeps the storage
+        void destroy_elements() noexcept
+        {
+            destroy_range(_elements, _elements + _count);
+            _count = 0;
+        }
+
+        // Copies [first, last) behind the last element, capacity must already suffice
+        template<typename InputIterator>
+        void append_copies(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first, ++_count)
+            {
+                new (_elements + _count) value_type(*first);
+            }
+        }
     };          
 
     // Non-member functions
@@ -389,25 +426,7 @@ namespace stlcontainer {
     template<class VectorDataType> 
     bool operator<(const Vector<VectorDataType>& lhs, const Vector<VectorDataType>& rhs)
     {
-        bool matchingElems = true;
-        for(auto index = 0; index < std::min(lhs.size(), rhs.size()); ++index)
-        {
-            if(lhs[index] > rhs[index])
-            {
-                return false;
-            }
-
-            matchingElems &= (lhs[index] == rhs[index]);
-        }
-
-        if (matchingElems) 
-        {
-            if (lhs.size() > rhs.size())
-            {
-                return false;
-            }    
-        }
-        return true;      
+        return std::lexicographical_compare(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());
     }
 
     template<class VectorDataType> 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+
+// Test element shared by the container tests. Lives in an unnamed namespace, so every test file gets its
+// own Counted and its own counter and the definition below can sit in the header.
+namespace
+{
+// Tracks live instances so tests can check every constructed value is destroyed. The counter is atomic for
+// the tests that construct and destroy values on several threads.
+struct Counted
+{
+    static std::atomic<int> live;
+    int value;
+
+    Counted(int val = 0) : value(val) { ++live; }
+    Counted(const Counted& other) : value(other.value) { ++live; }
+    Counted(Counted&& other) noexcept : value(other.value) { ++live; }
+    Counted& operator=(const Counted& other) = default;
+    Counted& operator=(Counted&& other) noexcept = default;
+    ~Counted() { --live; }
+
+    bool operator==(const Counted& other) const { return value == other.value; }
+    bool operator<(const Counted& other) const { return value < other.value; }
+};
+std::atomic<int> Counted::live(0);
+}
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "forward_list/ConcurrentForwardList.h"
+#include "../Counted.h"
+
+namespace
+{
+const int THREADS = 8;
+
+template<typename List>
+std::vector<int> values_of(List& list)
+{
+    typename List::guard_type guard;
+    return std::vector<int>(list.begin(), list.end());
+}
+}
+
+TEST(CONCURRENT_FORWARD_LIST, EMPTY_CREATION)
+{
+    stlcontainer::ConcurrentForwardList<int> list;
+    int value = 0;
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.size(), 0);
+    ASSERT_FALSE(list.try_pop_front(value));
+}
+
+TEST(CONCURRENT_FORWARD_LIST, SINGLE_THREAD)
+{
+    stlcontainer::ConcurrentForwardList<int> list = {2, 4};
+    list.push_front(1);
+    ASSERT_EQ(values_of(list), std::vector<int>({1, 2, 4}));
+
+    {
+        stlcontainer::ConcurrentForwardList<int>::guard_type guard;
+        auto iter = list.insert_after(std::next(list.begin()), 3);
+        ASSERT_EQ(*iter, 3);
+        ASSERT_TRUE(list.erase_after(list.before_begin()));
+        ASSERT_FALSE(list.erase_after(std::next(list.begin(), 2)));
+    }
+    ASSERT_EQ(values_of(list), std::vector<int>({2, 3, 4}));
+
+    int value = 0;
+    ASSERT_TRUE(list.try_pop_front(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_EQ(list.size(), 2);
+}
+
+TEST(CONCURRENT_FORWARD_LIST, ERASED_POSITION)
+{
+    stlcontainer::ConcurrentForwardList<int> list = {1, 2, 3};
+    stlcontainer::ConcurrentForwardList<int>::guard_type guard;
+
+    // Another thread erases the element pos refers to, pos stays readable but rejects edits
+    auto pos = list.begin();
+    std::thread([&] { list.erase_after(list.before_begin()); }).join();
+    ASSERT_EQ(*pos, 1);
+    ASSERT_EQ(list.insert_after(pos, 9), list.end());
+    ASSERT_FALSE(list.erase_after(pos));
+    ASSERT_EQ(*list.begin(), 2);
+}
+
+TEST(CONCURRENT_FORWARD_LIST, RECLAIMS_NODES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::ConcurrentForwardList<Counted> list;
+        for (int index = 0; index < 1000; ++index)
+        {
+            list.push_front(Counted(index));
+        }
+        Counted value;
+        while (list.try_pop_front(value))
+        {
+        }
+        ASSERT_TRUE(list.empty());
+    }
+    stlcontainer::EpochDomain::instance().collect();
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(CONCURRENT_FORWARD_LIST, CONCURRENT_PUSH_POP)
+{
+    const int PER_THREAD = 20000;
+    stlcontainer::ConcurrentForwardList<int> list;
+    std::vector<std::vector<int>> popped(THREADS);
+    std::vector<std::thread> threads;
+
+    // Half the threads push while the other half pop, then the poppers drain what is left
+    std::atomic<int> pushers_done(0);
+    for (int thread = 0; thread < THREADS; ++thread)
+    {
+        threads.emplace_back([&, thread] {
+            if (thread % 2 == 0)
+            {
+                for (int index = 0; index < PER_THREAD; ++index)
+                {
+                    list.push_front(thread * PER_THREAD + index);
+                }
+                ++pushers_done;
+                return;
+            }
+            int value;
+            while (pushers_done < THREADS / 2 || !list.empty())
+            {
+                if (list.try_pop_front(value))
+                {
+                    popped[thread].push_back(value);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every pushed value was popped exactly once
+    std::vector<int> all;
+    for (auto& values : popped)
+    {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(THREADS / 2 * PER_THREAD));
+    ASSERT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(CONCURRENT_FORWARD_LIST, CONCURRENT_INSERT_ERASE)
+{
+    const int OPERATIONS = 20000;
+    stlcontainer::ConcurrentForwardList<int> list;
+    for (int index = 0; index < 64; ++index)
+    {
+        list.push_front(-1);
+    }
+    std::atomic<int> inserted(0);
+    std::atomic<int> erased(0);
+    std::vector<std::thread> threads;
+
+    for (int thread = 0; thread < THREADS; ++thread)
+    {
+        threads.emplace_back([&, thread] {
+            unsigned state = thread + 1;
+            for (int step = 0; step < OPERATIONS; ++step)
+            {
+                state = state * 1103515245 + 12345;
+                stlcontainer::ConcurrentForwardList<int>::guard_type guard;
+
+                // Walk a few elements in, then edit there
+                auto pos = list.before_begin();
+                for (unsigned hops = (state >> 16) % 8; hops; --hops)
+                {
+                    auto next = std::next(pos);
+                    if (next == list.end())
+                    {
+                        break;
+                    }
+                    pos = next;
+                }
+                if ((state >> 8) % 2)
+                {
+                    inserted += list.insert_after(pos, thread) != list.end();
+                }
+                else
+                {
+                    erased += list.erase_after(pos);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(list.size(), static_cast<size_t>(64 + inserted - erased));
+}
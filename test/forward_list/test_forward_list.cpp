@@ -1,7 +1,36 @@
+#include <algorithm>
 #include <forward_list>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include "forward_list/ForwardList.h"
+#include "../Counted.h"
+
+namespace
+{
+// Counts copies and moves so tests can check values are built in place
+struct CopyCounted
+{
+    static int copies;
+    static int moves;
+    int first;
+    int second;
+
+    explicit CopyCounted(int val = 0, int val2 = 0) : first(val), second(val2) {}
+    CopyCounted(const CopyCounted& other) : first(other.first), second(other.second) { ++copies; }
+    CopyCounted(CopyCounted&& other) noexcept : first(other.first), second(other.second) { ++moves; }
+
+    static void reset() { copies = 0; moves = 0; }
+};
+int CopyCounted::copies = 0;
+int CopyCounted::moves = 0;
+}
 
 TEST(FORWARD_LIST, EMPTY_CREATION_DEFAULT_CONSTRUCTOR)
 {
@@ -544,4 +573,747 @@ TEST(FORWARD_LIST, SWAP_NM)
         ++size;
     }
     ASSERT_EQ(size, 4);
-}
\ No newline at end of file
+}
+
+TEST(FORWARD_LIST, EMPTY_SENTINEL)
+{
+    stlcontainer::ForwardList<int> list;
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_TRUE(++list.before_begin() == list.end());
+
+    // Empty list does not allocate a pool or a node
+    ASSERT_EQ(list.get_pool()->capacity(), 0);
+
+    list.insert_after(list.before_begin(), 3);
+    ASSERT_EQ(list.front(), 3);
+    ASSERT_TRUE(++list.begin() == list.end());
+}
+
+TEST(FORWARD_LIST, ITERATORS_DO_NOT_ALLOCATE)
+{
+    stlcontainer::ForwardList<int> list = {1, 2, 3};
+    auto pool = list.get_pool();
+    auto capacity = pool->capacity();
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        ASSERT_TRUE(++list.before_begin() == list.begin());
+        ASSERT_FALSE(list.begin() == list.end());
+    }
+    list.reverse();
+    ASSERT_EQ(pool->capacity(), capacity);
+    ASSERT_EQ(list.front(), 3);
+}
+
+TEST(FORWARD_LIST, DESTRUCTOR_FREES_VALUES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::ForwardList<Counted> list({1, 2, 3, 4});
+        stlcontainer::ForwardList<Counted> listCopy(list);
+        ASSERT_EQ(Counted::live, 8);
+
+        list.pop_front();
+        list.erase_after(list.begin());
+        ASSERT_EQ(Counted::live, 6);
+
+        listCopy = list;
+        ASSERT_EQ(Counted::live, 4);
+
+        list.assign(5, Counted(7));
+        ASSERT_EQ(Counted::live, 7);
+
+        list.resize(1);
+        list.remove(Counted(7));
+        ASSERT_TRUE(list.empty());
+        ASSERT_EQ(Counted::live, 2);
+
+        list = {1, 1, 2, 2};
+        list.unique();
+        ASSERT_EQ(Counted::live, 4);
+
+        stlcontainer::ForwardList<Counted> listMove(std::move(listCopy));
+        listMove = std::move(list);
+        ASSERT_EQ(Counted::live, 4);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(FORWARD_LIST, DESTRUCTOR_SHARED_POOL)
+{
+    Counted::live = 0;
+    stlcontainer::ForwardList<Counted> list1({1, 3});
+    {
+        stlcontainer::ForwardList<Counted> list2(list1.get_pool());
+        list2 = {2, 4};
+        list1.merge(list2);
+        list2 = {5, 6};
+        ASSERT_EQ(Counted::live, 6);
+    }
+
+    // list2's nodes went back to the shared free list instead of growing the pool
+    ASSERT_EQ(Counted::live, 4);
+    auto capacity = list1.get_pool()->capacity();
+    list1.push_front(Counted(0));
+    list1.push_front(Counted(0));
+    ASSERT_EQ(list1.get_pool()->capacity(), capacity);
+}
+
+TEST(FORWARD_LIST, REVERSE_EXACT)
+{
+    stlcontainer::ForwardList<int> list = {1, 2, 3};
+    list.reverse();
+
+    std::forward_list<int> listCompare(list.begin(), list.end());
+    ASSERT_EQ(listCompare, std::forward_list<int>({3, 2, 1}));
+
+    stlcontainer::ForwardList<int> listEmpty;
+    listEmpty.reverse();
+    ASSERT_TRUE(listEmpty.empty());
+}
+
+TEST(FORWARD_LIST, UNIQUE_TRAILING_DEFAULTS)
+{
+    stlcontainer::ForwardList<int> list = {1, 0, 0};
+    list.unique();
+
+    std::forward_list<int> listCompare(list.begin(), list.end());
+    ASSERT_EQ(listCompare, std::forward_list<int>({1, 0}));
+}
+
+TEST(FORWARD_LIST, RESIZE_VALUE)
+{
+    stlcontainer::ForwardList<int> list = {1, 2};
+    list.resize(4, 9);
+
+    std::forward_list<int> listCompare(list.begin(), list.end());
+    ASSERT_EQ(listCompare, std::forward_list<int>({1, 2, 9, 9}));
+}
+
+TEST(FORWARD_LIST, SORT)
+{
+    stlcontainer::ForwardList<int> list = {5, 1, 4, 9, 0, 3, 3, 8, 2, 7, 6};
+    std::forward_list<int> listCompare = {5, 1, 4, 9, 0, 3, 3, 8, 2, 7, 6};
+    list.sort();
+    listCompare.sort();
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), listCompare);
+
+    list.sort(std::greater<int>());
+    listCompare.sort(std::greater<int>());
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), listCompare);
+
+    stlcontainer::ForwardList<int> listEmpty;
+    listEmpty.sort();
+    ASSERT_TRUE(listEmpty.empty());
+
+    stlcontainer::ForwardList<int> listSingle = {1};
+    listSingle.sort();
+    ASSERT_EQ(listSingle.front(), 1);
+}
+
+TEST(FORWARD_LIST, SORT_LARGE)
+{
+    stlcontainer::ForwardList<int> list;
+    std::forward_list<int> listCompare;
+    unsigned seed = 12345;
+    for (int index = 0; index < 10000; ++index)
+    {
+        seed = seed * 1103515245 + 12345;
+        list.push_front(static_cast<int>(seed >> 16) % 1000);
+        listCompare.push_front(static_cast<int>(seed >> 16) % 1000);
+    }
+    list.sort();
+    listCompare.sort();
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), listCompare);
+}
+
+TEST(FORWARD_LIST, SORT_STABLE_NO_COPIES)
+{
+    // Sort pairs by first only, second records original order
+    using Pair = std::pair<int, int>;
+    auto byFirst = [](const Pair& lhs, const Pair& rhs) { return lhs.first < rhs.first; };
+    stlcontainer::ForwardList<Pair> list = {{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}, {2, 5}};
+    list.sort(byFirst);
+    std::forward_list<Pair> sorted(list.begin(), list.end());
+    ASSERT_EQ(sorted, std::forward_list<Pair>({{0, 4}, {1, 1}, {1, 3}, {2, 0}, {2, 2}, {2, 5}}));
+
+    // Relinking only: no values constructed, no nodes allocated
+    Counted::live = 0;
+    stlcontainer::ForwardList<Counted> listCounted = {3, 1, 2};
+    auto capacity = listCounted.get_pool()->capacity();
+    auto first = &listCounted.front();
+    listCounted.sort();
+    ASSERT_EQ(Counted::live, 3);
+    ASSERT_EQ(listCounted.get_pool()->capacity(), capacity);
+    ASSERT_EQ(first, &*(++(++listCounted.begin())));
+}
+
+TEST(FORWARD_LIST, MERGE_COMPARE)
+{
+    stlcontainer::ForwardList<int> list1 = {9, 6, 2};
+    stlcontainer::ForwardList<int> list2 = {8, 7, 2, 1};
+    std::forward_list<int> listCompare1 = {9, 6, 2};
+    std::forward_list<int> listCompare2 = {8, 7, 2, 1};
+    list1.merge(list2, std::greater<int>());
+    listCompare1.merge(listCompare2, std::greater<int>());
+
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+    ASSERT_TRUE(list2.empty());
+
+    // Rvalue overloads
+    list1.merge(stlcontainer::ForwardList<int>({10, 0}), std::greater<int>());
+    listCompare1.merge(std::forward_list<int>({10, 0}), std::greater<int>());
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+
+    stlcontainer::ForwardList<int> list3 = {1, 5};
+    list3.merge(stlcontainer::ForwardList<int>({0, 3, 7}));
+    ASSERT_EQ(std::forward_list<int>(list3.begin(), list3.end()), std::forward_list<int>({0, 1, 3, 5, 7}));
+
+    // Merging with itself is a no-op
+    list3.merge(list3);
+    ASSERT_EQ(std::forward_list<int>(list3.begin(), list3.end()), std::forward_list<int>({0, 1, 3, 5, 7}));
+}
+
+TEST(FORWARD_LIST, SPLICE_AFTER_LIST)
+{
+    stlcontainer::ForwardList<int> list1 = {1, 2, 3};
+    stlcontainer::ForwardList<int> list2 = {4, 5};
+    std::forward_list<int> listCompare1 = {1, 2, 3};
+    std::forward_list<int> listCompare2 = {4, 5};
+
+    auto second = list2.begin();
+    list1.splice_after(list1.begin(), list2);
+    listCompare1.splice_after(listCompare1.begin(), listCompare2);
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+    ASSERT_TRUE(list2.empty());
+
+    // Iterators to spliced elements stay valid
+    ASSERT_EQ(*second, 4);
+
+    // Splicing an empty list, and rvalue overload at the end
+    list1.splice_after(list1.before_begin(), list2);
+    list1.splice_after(list1.begin(), stlcontainer::ForwardList<int>({7, 8}));
+    listCompare1.splice_after(listCompare1.begin(), std::forward_list<int>({7, 8}));
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+}
+
+TEST(FORWARD_LIST, SPLICE_AFTER_ELEMENT)
+{
+    stlcontainer::ForwardList<int> list1 = {1, 2, 3};
+    stlcontainer::ForwardList<int> list2 = {4, 5, 6};
+    std::forward_list<int> listCompare1 = {1, 2, 3};
+    std::forward_list<int> listCompare2 = {4, 5, 6};
+
+    list1.splice_after(list1.before_begin(), list2, list2.begin());
+    listCompare1.splice_after(listCompare1.before_begin(), listCompare2, listCompare2.begin());
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+    ASSERT_EQ(std::forward_list<int>(list2.begin(), list2.end()), listCompare2);
+
+    // Within the same list: move the front element to the back
+    auto last = list1.begin();
+    auto lastCompare = listCompare1.begin();
+    for (int index = 0; index < 3; ++index, ++last, ++lastCompare);
+    list1.splice_after(last, list1, list1.before_begin());
+    listCompare1.splice_after(lastCompare, listCompare1, listCompare1.before_begin());
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+
+    // No-ops: element after pos, pos itself, nothing after it
+    list1.splice_after(list1.before_begin(), list1, list1.before_begin());
+    list1.splice_after(list1.begin(), list1, list1.before_begin());
+    list1.splice_after(list1.begin(), list2, std::next(last));
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+
+    list1.splice_after(list1.before_begin(), std::move(list2), list2.before_begin());
+    listCompare1.splice_after(listCompare1.before_begin(), listCompare2, listCompare2.before_begin());
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+}
+
+TEST(FORWARD_LIST, SPLICE_AFTER_RANGE)
+{
+    stlcontainer::ForwardList<int> list1 = {1, 2, 3};
+    stlcontainer::ForwardList<int> list2 = {4, 5, 6, 7};
+    std::forward_list<int> listCompare1 = {1, 2, 3};
+    std::forward_list<int> listCompare2 = {4, 5, 6, 7};
+
+    auto last = list2.begin();
+    auto lastCompare = listCompare2.begin();
+    std::advance(last, 3);
+    std::advance(lastCompare, 3);
+    list1.splice_after(list1.begin(), list2, list2.begin(), last);
+    listCompare1.splice_after(listCompare1.begin(), listCompare2, listCompare2.begin(), lastCompare);
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+    ASSERT_EQ(std::forward_list<int>(list2.begin(), list2.end()), listCompare2);
+
+    // Empty range and the whole remainder of the same list
+    list1.splice_after(list1.begin(), list2, list2.begin(), std::next(list2.begin()));
+    list1.splice_after(list1.before_begin(), list1, std::next(list1.begin(), 2), list1.end());
+    listCompare1.splice_after(listCompare1.before_begin(), listCompare1, std::next(listCompare1.begin(), 2), listCompare1.end());
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+
+    list1.splice_after(list1.before_begin(), std::move(list2), list2.before_begin(), list2.end());
+    listCompare1.splice_after(listCompare1.before_begin(), listCompare2, listCompare2.before_begin(), listCompare2.end());
+    ASSERT_EQ(std::forward_list<int>(list1.begin(), list1.end()), listCompare1);
+    ASSERT_TRUE(list2.empty());
+}
+
+TEST(FORWARD_LIST, SPLICE_AFTER_NO_COPIES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::ForwardList<Counted> list1 = {1, 2};
+        auto capacity = list1.get_pool()->capacity();
+        {
+            stlcontainer::ForwardList<Counted> list2 = {3, 4, 5};
+            ASSERT_EQ(Counted::live, 5);
+            list1.splice_after(list1.begin(), list2, list2.begin(), list2.end());
+            list1.splice_after(list1.before_begin(), list2);
+            ASSERT_EQ(Counted::live, 5);
+            ASSERT_EQ(list1.get_pool(), list2.get_pool());
+        }
+
+        // list2's pool went into list1's, its nodes are alive and no new node was allocated
+        ASSERT_EQ(Counted::live, 5);
+        ASSERT_EQ(list1.get_pool()->capacity(), 2 * capacity);
+        std::vector<int> values;
+        for (const auto& elem : list1)
+        {
+            values.push_back(elem.value);
+        }
+        ASSERT_EQ(values, std::vector<int>({3, 1, 4, 5, 2}));
+    }
+    ASSERT_EQ(Counted::live, 0);
+
+    // A list sharing a pool that was joined into another moves over to the surviving pool on its next insert
+    stlcontainer::ForwardList<int> survivor = {1};
+    stlcontainer::ForwardList<int> joined = {2};
+    stlcontainer::ForwardList<int> sharing(joined.get_pool());
+    survivor.splice_after(survivor.begin(), joined);
+    sharing.push_front(3);
+    ASSERT_EQ(sharing.get_pool(), survivor.get_pool());
+    ASSERT_FALSE(sharing.get_pool()->is_forwarded());
+}
+
+TEST(FORWARD_LIST, SIZE)
+{
+    stlcontainer::ForwardList<int> list;
+    ASSERT_EQ(list.size(), 0);
+    list = {1, 2, 3};
+    ASSERT_EQ(list.size(), 3);
+    ASSERT_EQ(sizeof(list), sizeof(stlcontainer::ForwardList<int>::pool_type::pool_pointer) + sizeof(void*));
+}
+
+TEST(FORWARD_LIST, SIZE_TRACKED)
+{
+    stlcontainer::SizedForwardList<int> list1(3, 1);
+    ASSERT_EQ(list1.size(), 3);
+
+    list1.push_front(0);
+    list1.insert_after(list1.begin(), {5, 6});
+    ASSERT_EQ(list1.size(), 6);
+    list1.erase_after(list1.begin(), list1.end());
+    ASSERT_EQ(list1.size(), 1);
+    list1.resize(4);
+    ASSERT_EQ(list1.size(), 4);
+    list1.resize(2);
+    ASSERT_EQ(list1.size(), 2);
+
+    stlcontainer::SizedForwardList<int> list2 = {4, 2, 9};
+    list1.splice_after(list1.before_begin(), list2, list2.begin());
+    ASSERT_EQ(list1.size(), 3);
+    ASSERT_EQ(list2.size(), 2);
+    list1.splice_after(list1.before_begin(), list1, list1.begin());
+    ASSERT_EQ(list1.size(), 3);
+    list1.splice_after(list1.begin(), list2, list2.before_begin(), list2.end());
+    ASSERT_EQ(list1.size(), 5);
+    ASSERT_EQ(list2.size(), 0);
+
+    list2 = {7, 8};
+    list1.sort();
+    list2.merge(list1);
+    ASSERT_EQ(list2.size(), 7);
+    ASSERT_EQ(list1.size(), 0);
+    ASSERT_EQ(static_cast<size_t>(std::distance(list2.begin(), list2.end())), list2.size());
+
+    swap(list1, list2);
+    ASSERT_EQ(list1.size(), 7);
+    stlcontainer::SizedForwardList<int> list3(std::move(list1));
+    ASSERT_EQ(list3.size(), 7);
+    ASSERT_EQ(list1.size(), 0);
+    list3.remove(1);
+    list3.unique();
+    ASSERT_EQ(static_cast<size_t>(std::distance(list3.begin(), list3.end())), list3.size());
+    list3.clear();
+    ASSERT_EQ(list3.size(), 0);
+}
+
+TEST(FORWARD_LIST, EMPLACE_FRONT)
+{
+    stlcontainer::ForwardList<std::pair<int, std::string>> list;
+    std::forward_list<std::pair<int, std::string>> listCompare;
+
+    auto& front = list.emplace_front(1, "one");
+    listCompare.emplace_front(1, "one");
+    list.emplace_front(2, "two");
+    listCompare.emplace_front(2, "two");
+    ASSERT_EQ(front.second, "one");
+    ASSERT_EQ(list.front(), listCompare.front());
+    ASSERT_TRUE(std::equal(list.begin(), list.end(), listCompare.begin()));
+}
+
+TEST(FORWARD_LIST, EMPLACE_AFTER)
+{
+    stlcontainer::ForwardList<std::string> list = {"a", "d"};
+    std::forward_list<std::string> listCompare = {"a", "d"};
+
+    auto iter = list.emplace_after(list.begin(), 3, 'c');
+    auto compareIter = listCompare.emplace_after(listCompare.begin(), 3, 'c');
+    ASSERT_EQ(*iter, *compareIter);
+    list.emplace_after(list.before_begin());
+    listCompare.emplace_after(listCompare.before_begin());
+    ASSERT_EQ(std::forward_list<std::string>(list.begin(), list.end()), listCompare);
+}
+
+TEST(FORWARD_LIST, INSERT_NO_COPIES)
+{
+    stlcontainer::ForwardList<CopyCounted> list;
+    CopyCounted::reset();
+
+    list.emplace_front(1, 2);
+    list.emplace_after(list.begin(), 3, 4);
+    list.emplace_after(list.before_begin());
+    ASSERT_EQ(CopyCounted::copies, 0);
+    ASSERT_EQ(CopyCounted::moves, 0);
+
+    // Rvalues are moved once, straight into the node
+    list.push_front(CopyCounted(5));
+    list.insert_after(list.begin(), CopyCounted(6));
+    ASSERT_EQ(CopyCounted::copies, 0);
+    ASSERT_EQ(CopyCounted::moves, 2);
+
+    // Lvalues are copied once
+    CopyCounted value(7);
+    list.push_front(value);
+    list.insert_after(list.begin(), value);
+    ASSERT_EQ(CopyCounted::copies, 2);
+    ASSERT_EQ(CopyCounted::moves, 2);
+
+    std::vector<int> values;
+    for (const auto& elem : list)
+    {
+        values.push_back(elem.first);
+    }
+    ASSERT_EQ(values, std::vector<int>({7, 7, 5, 6, 0, 1, 3}));
+}
+
+TEST(FORWARD_LIST, EMPLACE_THROWS)
+{
+    struct Throwing
+    {
+        explicit Throwing(bool fail) { if (fail) throw std::runtime_error("construct"); }
+    };
+
+    stlcontainer::SizedForwardList<Throwing> list;
+    list.emplace_front(false);
+    auto capacity = list.get_pool()->capacity();
+    for (int index = 0; index < 100; ++index)
+    {
+        ASSERT_THROW(list.emplace_front(true), std::runtime_error);
+    }
+
+    // The failed slots went back to the pool and the list is unchanged
+    ASSERT_EQ(list.get_pool()->capacity(), capacity);
+    ASSERT_EQ(list.size(), 1);
+}
+
+TEST(FORWARD_LIST, REMOVE_IF)
+{
+    // Long enough to span several free batches
+    stlcontainer::ForwardList<int> list;
+    std::forward_list<int> listCompare;
+    for (int index = 0; index < 1000; ++index)
+    {
+        list.push_front(index);
+        listCompare.push_front(index);
+    }
+
+    auto isOdd = [](int value) { return value % 2 != 0; };
+    list.remove_if(isOdd);
+    listCompare.remove_if(isOdd);
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), listCompare);
+
+    list.remove_if([](int value) { return value < 100; });
+    listCompare.remove_if([](int value) { return value < 100; });
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), listCompare);
+
+    list.remove_if([](int) { return true; });
+    ASSERT_TRUE(list.empty());
+    list.remove_if([](int) { return true; });
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(FORWARD_LIST, REMOVE_IF_SIZE_AND_VALUES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::SizedForwardList<Counted> list;
+        for (int index = 0; index < 300; ++index)
+        {
+            list.push_front(Counted(index % 3));
+        }
+        list.remove_if([](const Counted& elem) { return elem.value == 1; });
+        ASSERT_EQ(list.size(), 200);
+        ASSERT_EQ(Counted::live, 200);
+
+        // A throwing predicate leaves the list consistent and frees what was already unlinked
+        int calls = 0;
+        ASSERT_THROW(list.remove_if([&calls](const Counted& elem) {
+            if (++calls == 150)
+            {
+                throw std::runtime_error("predicate");
+            }
+            return elem.value == 0;
+        }), std::runtime_error);
+        ASSERT_EQ(list.size(), static_cast<size_t>(Counted::live));
+        ASSERT_EQ(std::distance(list.begin(), list.end()), Counted::live);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(FORWARD_LIST, REMOVE_ALIASED_VALUE)
+{
+    // The argument refers to an element that gets removed, before others equal to it
+    stlcontainer::ForwardList<std::string> list;
+    for (int index = 0; index < 200; ++index)
+    {
+        list.push_front(index % 2 ? "odd" : "even");
+    }
+    list.remove(*std::next(list.begin()));
+
+    ASSERT_EQ(std::distance(list.begin(), list.end()), 100);
+    ASSERT_TRUE(std::all_of(list.begin(), list.end(), [](const std::string& elem) { return elem == "odd"; }));
+}
+
+TEST(FORWARD_LIST, UNIQUE_PREDICATE)
+{
+    stlcontainer::ForwardList<int> list = {1, 2, 12, 3, 13, 23, 4, 5, 15};
+    std::forward_list<int> listCompare = {1, 2, 12, 3, 13, 23, 4, 5, 15};
+
+    auto sameDigit = [](int lhs, int rhs) { return lhs % 10 == rhs % 10; };
+    list.unique(sameDigit);
+    listCompare.unique(sameDigit);
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), listCompare);
+
+    // The predicate compares against the first element of the run, not the previous one
+    list = {1, 2, 3, 10, 11};
+    list.unique([](int first, int elem) { return elem - first < 3; });
+    ASSERT_EQ(std::forward_list<int>(list.begin(), list.end()), std::forward_list<int>({1, 10}));
+
+    stlcontainer::SizedForwardList<int> sized(500, 7);
+    sized.unique(std::equal_to<int>());
+    ASSERT_EQ(sized.size(), 1);
+    ASSERT_EQ(sized.front(), 7);
+}
+
+TEST(FORWARD_LIST, COMPACT)
+{
+    stlcontainer::ForwardList<int> list;
+    for (int index = 0; index < 5000; ++index)
+    {
+        list.push_front((index * 7919) % 5000);
+    }
+    list.sort();
+    std::vector<int> values(list.begin(), list.end());
+    ASSERT_GT(list.locality_score(), 2.0);
+
+    list.compact();
+    ASSERT_EQ(std::vector<int>(list.begin(), list.end()), values);
+    ASSERT_DOUBLE_EQ(list.locality_score(), 1.0);
+    ASSERT_EQ(list.get_pool()->chunk_count(), 1);
+    ASSERT_EQ(list.get_pool()->capacity(), 5000);
+
+    // Nodes sit back to back in iteration order, one constant stride apart
+    auto stride = reinterpret_cast<const char*>(&*std::next(list.begin())) - reinterpret_cast<const char*>(&*list.begin());
+    ASSERT_GT(stride, 0);
+    for (auto iter = list.begin(); std::next(iter) != list.end(); ++iter)
+    {
+        ASSERT_EQ(reinterpret_cast<const char*>(&*std::next(iter)) - reinterpret_cast<const char*>(&*iter), stride);
+    }
+
+    // The list keeps working on its new pool
+    list.push_front(-1);
+    list.remove_if([](int value) { return value % 2 == 0; });
+    ASSERT_EQ(list.front(), -1);
+}
+
+TEST(FORWARD_LIST, COMPACT_VALUES_AND_SIZE)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::SizedForwardList<Counted> list;
+        for (int index = 0; index < 100; ++index)
+        {
+            list.push_front(Counted(index));
+        }
+        list.remove_if([](const Counted& elem) { return elem.value % 3 == 0; });
+        ASSERT_EQ(Counted::live, 66);
+
+        list.compact();
+        ASSERT_EQ(list.size(), 66);
+        ASSERT_EQ(Counted::live, 66);
+        ASSERT_EQ(list.front().value, 98);
+        ASSERT_DOUBLE_EQ(list.locality_score(), 1.0);
+
+        stlcontainer::SizedForwardList<Counted> empty;
+        empty.compact();
+        ASSERT_TRUE(empty.empty());
+        ASSERT_DOUBLE_EQ(empty.locality_score(), 1.0);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(FORWARD_LIST, COMPACT_SHARED_POOL)
+{
+    stlcontainer::ForwardList<std::string> list1 = {"a", "b", "c"};
+    stlcontainer::ForwardList<std::string> list2(list1.get_pool());
+    list2 = {"x", "y"};
+
+    // list1 moves to a pool of its own, list2's nodes stay where they are
+    auto list2Front = &list2.front();
+    list1.compact();
+    ASSERT_NE(list1.get_pool(), list2.get_pool());
+    ASSERT_EQ(&list2.front(), list2Front);
+    ASSERT_EQ(std::vector<std::string>(list1.begin(), list1.end()), std::vector<std::string>({"a", "b", "c"}));
+
+    // Relinking between the two pools still works
+    list1.splice_after(list1.before_begin(), list2);
+    ASSERT_EQ(std::vector<std::string>(list1.begin(), list1.end()), std::vector<std::string>({"x", "y", "a", "b", "c"}));
+}
+
+TEST(FORWARD_LIST, COMPACT_THROWS)
+{
+    // Copy can throw and there is no move, so compact copies and must undo on failure
+    struct CopyThrows
+    {
+        int* copies_left;
+        int value;
+
+        CopyThrows(int* copies, int val) : copies_left(copies), value(val) {}
+        CopyThrows(const CopyThrows& other) : copies_left(other.copies_left), value(other.value)
+        {
+            if ((*copies_left)-- == 0)
+            {
+                throw std::runtime_error("copy");
+            }
+        }
+    };
+
+    int copiesLeft = 0;
+    stlcontainer::ForwardList<CopyThrows> list;
+    for (int index = 0; index < 10; ++index)
+    {
+        list.emplace_front(&copiesLeft, index);
+    }
+    auto front = &list.front();
+
+    copiesLeft = 5;
+    ASSERT_THROW(list.compact(), std::runtime_error);
+    ASSERT_EQ(&list.front(), front);
+    int expected = 9;
+    for (const auto& elem : list)
+    {
+        ASSERT_EQ(elem.value, expected--);
+    }
+    ASSERT_EQ(expected, -1);
+
+    copiesLeft = 100;
+    list.compact();
+    ASSERT_EQ(list.front().value, 9);
+}
+
+TEST(FORWARD_LIST, RELATIONAL_OPERATORS)
+{
+    std::vector<std::vector<int>> cases = {{}, {1}, {1, 2}, {1, 2, 3}, {1, 3}, {2}, {0, 9, 9}, {1, 2, 2}};
+    for (const auto& lhsValues : cases)
+    {
+        for (const auto& rhsValues : cases)
+        {
+            stlcontainer::ForwardList<int> lhs;
+            stlcontainer::ForwardList<int> rhs;
+            for (auto iter = lhsValues.rbegin(); iter != lhsValues.rend(); ++iter)
+            {
+                lhs.push_front(*iter);
+            }
+            for (auto iter = rhsValues.rbegin(); iter != rhsValues.rend(); ++iter)
+            {
+                rhs.push_front(*iter);
+            }
+            std::forward_list<int> lhsCompare(lhsValues.begin(), lhsValues.end());
+            std::forward_list<int> rhsCompare(rhsValues.begin(), rhsValues.end());
+
+            EXPECT_EQ(lhs == rhs, lhsCompare == rhsCompare);
+            EXPECT_EQ(lhs != rhs, lhsCompare != rhsCompare);
+            EXPECT_EQ(lhs < rhs, lhsCompare < rhsCompare);
+            EXPECT_EQ(lhs > rhs, lhsCompare > rhsCompare);
+            EXPECT_EQ(lhs <= rhs, lhsCompare <= rhsCompare);
+            EXPECT_EQ(lhs >= rhs, lhsCompare >= rhsCompare);
+        }
+    }
+}
+
+TEST(FORWARD_LIST, RELATIONAL_OPERATORS_EARLY_EXIT)
+{
+    // Counts element comparisons
+    struct Compared
+    {
+        int value;
+        int* comparisons;
+
+        bool operator==(const Compared& other) const { ++*comparisons; return value == other.value; }
+        bool operator<(const Compared& other) const { ++*comparisons; return value < other.value; }
+    };
+
+    int comparisons = 0;
+    stlcontainer::SizedForwardList<Compared> lhs;
+    stlcontainer::SizedForwardList<Compared> rhs;
+    for (int index = 0; index < 100; ++index)
+    {
+        lhs.push_front(Compared{index, &comparisons});
+        rhs.push_front(Compared{index == 98 ? -1 : index, &comparisons});
+    }
+
+    // Decided by the second element
+    ASSERT_FALSE(lhs == rhs);
+    ASSERT_EQ(comparisons, 2);
+    comparisons = 0;
+    ASSERT_TRUE(rhs < lhs);
+    ASSERT_EQ(comparisons, 3);
+
+    // Tracked sizes differ: no element is compared
+    comparisons = 0;
+    rhs.pop_front();
+    ASSERT_TRUE(lhs != rhs);
+    ASSERT_EQ(comparisons, 0);
+}
+
+TEST(FORWARD_LIST, HASH)
+{
+    std::hash<stlcontainer::ForwardList<int>> hasher;
+    stlcontainer::ForwardList<int> list1 = {1, 2, 3};
+    stlcontainer::ForwardList<int> list2 = {1, 2, 3};
+    stlcontainer::ForwardList<int> reordered = {3, 2, 1};
+    stlcontainer::ForwardList<int> longer = {1, 2, 3, 0};
+
+    ASSERT_EQ(hasher(list1), hasher(list2));
+    ASSERT_NE(hasher(list1), hasher(reordered));
+    ASSERT_NE(hasher(list1), hasher(longer));
+    ASSERT_NE(hasher(stlcontainer::ForwardList<int>()), hasher(stlcontainer::ForwardList<int>({0})));
+
+    // Dedupe by content
+    std::unordered_set<stlcontainer::ForwardList<std::string>> lists;
+    lists.insert({"a", "b"});
+    lists.insert({"b", "a"});
+    lists.insert({"a", "b"});
+    lists.insert(stlcontainer::ForwardList<std::string>());
+    ASSERT_EQ(lists.size(), 3);
+    ASSERT_EQ(lists.count(stlcontainer::ForwardList<std::string>({"b", "a"})), 1);
+}
@@ -0,0 +1,179 @@
+#include <forward_list>
+#include <set>
+
+#include <gtest/gtest.h>
+#include "forward_list/ForwardList.h"
+
+namespace
+{
+struct Node
+{
+    Node* next;
+    long value;
+};
+using NodePool = stlcontainer::ForwardListNodePool<Node>;
+}
+
+TEST(FORWARD_LIST_NODE_POOL, EMPTY_CREATION)
+{
+    NodePool pool;
+    ASSERT_EQ(pool.capacity(), 0);
+    ASSERT_EQ(pool.chunk_count(), 0);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, ALLOCATE_CONTIGUOUS)
+{
+    NodePool pool;
+    auto first = static_cast<char*>(pool.allocate());
+    ASSERT_EQ(pool.chunk_count(), 1);
+    ASSERT_EQ(pool.capacity(), NodePool::MIN_CHUNK_NODES);
+
+    // Slots of one chunk are handed out back to back
+    for (size_t index = 1; index < NodePool::MIN_CHUNK_NODES; ++index)
+    {
+        auto slot = static_cast<char*>(pool.allocate());
+        ASSERT_EQ(static_cast<size_t>(slot - first) % sizeof(Node), 0);
+        ASSERT_GT(slot, first);
+    }
+    ASSERT_EQ(pool.chunk_count(), 1);
+
+    // Chunks grow geometrically
+    pool.allocate();
+    ASSERT_EQ(pool.chunk_count(), 2);
+    ASSERT_EQ(pool.capacity(), 3 * NodePool::MIN_CHUNK_NODES);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, MAX_CHUNK)
+{
+    NodePool pool(32);
+    for (size_t index = 0; index < 16 + 32 + 32; ++index)
+    {
+        pool.allocate();
+    }
+    ASSERT_EQ(pool.chunk_count(), 3);
+    ASSERT_EQ(pool.capacity(), 16 + 32 + 32);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, RESERVE_CONTIGUOUS)
+{
+    NodePool pool;
+    auto first = static_cast<Node*>(pool.allocate());
+
+    // The rest of the first chunk suffices
+    pool.reserve_contiguous(NodePool::MIN_CHUNK_NODES - 1);
+    ASSERT_EQ(pool.chunk_count(), 1);
+
+    // One chunk of exactly the requested size, the first chunk's unused slots go to the free list
+    pool.reserve_contiguous(1000);
+    ASSERT_EQ(pool.chunk_count(), 2);
+    ASSERT_EQ(pool.capacity(), NodePool::MIN_CHUNK_NODES + 1000);
+    for (size_t index = 1; index < NodePool::MIN_CHUNK_NODES; ++index)
+    {
+        auto slot = static_cast<Node*>(pool.allocate());
+        ASSERT_GT(slot, first);
+        ASSERT_LT(slot, first + NodePool::MIN_CHUNK_NODES);
+    }
+
+    auto slab = static_cast<Node*>(pool.allocate());
+    for (size_t index = 1; index < 1000; ++index)
+    {
+        ASSERT_EQ(pool.allocate(), slab + index);
+    }
+    ASSERT_EQ(pool.chunk_count(), 2);
+
+    // Regular growth carries on where it left off
+    pool.allocate();
+    ASSERT_EQ(pool.chunk_count(), 3);
+    ASSERT_EQ(pool.capacity(), NodePool::MIN_CHUNK_NODES + 1000 + 2 * NodePool::MIN_CHUNK_NODES);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, RECYCLE)
+{
+    NodePool pool;
+    auto a = pool.allocate();
+    auto b = pool.allocate();
+    pool.deallocate(a);
+    pool.deallocate(b);
+
+    // Free list is LIFO
+    ASSERT_EQ(pool.allocate(), b);
+    ASSERT_EQ(pool.allocate(), a);
+    ASSERT_EQ(pool.chunk_count(), 1);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, JOIN)
+{
+    auto lhs = std::make_shared<NodePool>();
+    auto rhs = std::make_shared<NodePool>();
+    auto lhsSlot = lhs->allocate();
+    auto rhsSlot = rhs->allocate();
+
+    auto root = NodePool::join(lhs, rhs);
+    ASSERT_EQ(root, lhs);
+    ASSERT_EQ(NodePool::root(rhs), lhs);
+    ASSERT_EQ(lhs->chunk_count(), 2);
+    ASSERT_EQ(rhs->chunk_count(), 0);
+
+    // rhs's unused slots are now lhs's to hand out, without adding chunks
+    std::set<void*> seen = {lhsSlot, rhsSlot};
+    for (size_t index = 0; index < 2 * NodePool::MIN_CHUNK_NODES - 2; ++index)
+    {
+        ASSERT_TRUE(seen.insert(lhs->allocate()).second);
+    }
+    ASSERT_EQ(lhs->chunk_count(), 2);
+
+    // Joining again is a no-op, rhs keeps its slots alive after its owner lets go
+    ASSERT_EQ(NodePool::join(rhs, lhs), lhs);
+    lhs->deallocate(rhsSlot);
+    lhs.reset();
+    ASSERT_EQ(NodePool::root(rhs)->chunk_count(), 2);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, LIST_REUSES_SLOTS)
+{
+    stlcontainer::ForwardList<int> list({1, 2, 3});
+    auto pool = list.get_pool();
+    auto capacity = pool->capacity();
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        list.push_front(index);
+        list.pop_front();
+    }
+    ASSERT_EQ(pool->capacity(), capacity);
+    ASSERT_EQ(list.front(), 1);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, SHARED_POOL)
+{
+    auto pool = std::make_shared<stlcontainer::ForwardList<int>::pool_type>();
+    stlcontainer::ForwardList<int> list1(pool);
+    stlcontainer::ForwardList<int> list2(pool);
+    list1.push_front(2);
+    list2.push_front(1);
+
+    ASSERT_EQ(list1.get_pool(), list2.get_pool());
+    ASSERT_EQ(pool->chunk_count(), 1);
+}
+
+TEST(FORWARD_LIST_NODE_POOL, MERGE_ACROSS_POOLS)
+{
+    std::forward_list<int> listCompare;
+    {
+        stlcontainer::ForwardList<int> list1 = {0, 3, 5, 6};
+        {
+            stlcontainer::ForwardList<int> list2 = {1, 2, 3, 7};
+            list1.merge(list2);
+            ASSERT_EQ(list1.get_pool(), list2.get_pool());
+            ASSERT_TRUE(list2.empty());
+        }
+
+        // list2 and its original pool are gone, its nodes must still be alive in list1
+        for (auto elem : list1)
+        {
+            listCompare.push_front(elem);
+        }
+    }
+    listCompare.reverse();
+    ASSERT_EQ(listCompare, std::forward_list<int>({0, 1, 2, 3, 3, 5, 6, 7}));
+}
@@ -0,0 +1,304 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "forward_list/IntrusiveForwardList.h"
+
+namespace
+{
+// Neither copyable nor movable: the list can only ever link the caller's objects
+struct Item
+{
+    std::string name;
+    int value;
+    stlcontainer::IntrusiveForwardListHook hook;
+    stlcontainer::IntrusiveForwardListHook other_hook;
+
+    Item(int val = 0) : name("item"), value(val) {}
+    Item(const Item& other) = delete;
+    Item& operator=(const Item& other) = delete;
+};
+
+using ItemList = stlcontainer::IntrusiveForwardList<Item, &Item::hook>;
+using OtherItemList = stlcontainer::IntrusiveForwardList<Item, &Item::other_hook>;
+
+template<typename List>
+std::vector<int> values_of(const List& list)
+{
+    std::vector<int> values;
+    for (const auto& elem : list)
+    {
+        values.push_back(elem.value);
+    }
+    return values;
+}
+
+struct INTRUSIVE_FORWARD_LIST : public ::testing::Test
+{
+    Item items[8] = {{0}, {1}, {2}, {3}, {4}, {5}, {6}, {7}};
+};
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, EMPTY_CREATION)
+{
+    ItemList list;
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.size(), 0);
+    ASSERT_EQ(list.begin(), list.end());
+    ASSERT_EQ(++list.before_begin(), list.end());
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, PUSH_POP)
+{
+    ItemList list;
+    list.push_front(items[1]);
+    list.push_front(items[0]);
+    list.push_back(items[2]);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2}));
+    ASSERT_EQ(&list.front(), &items[0]);
+    ASSERT_EQ(&list.back(), &items[2]);
+    ASSERT_EQ(list.size(), 3);
+
+    list.pop_front();
+    list.pop_front();
+    ASSERT_EQ(&list.front(), &items[2]);
+    ASSERT_EQ(&list.back(), &items[2]);
+
+    list.pop_front();
+    ASSERT_TRUE(list.empty());
+
+    // The tail follows the list back to empty
+    list.push_back(items[3]);
+    ASSERT_EQ(values_of(list), std::vector<int>({3}));
+    ASSERT_EQ(&list.back(), &items[3]);
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, ITERATORS)
+{
+    ItemList list;
+    for (auto& item : items)
+    {
+        list.push_back(item);
+    }
+
+    int expected = 0;
+    for (auto iter = list.begin(); iter != list.end(); ++iter)
+    {
+        ASSERT_EQ(&*iter, &items[expected]);
+        ASSERT_EQ(iter->value, expected);
+        ++expected;
+    }
+    ASSERT_EQ(expected, 8);
+
+    auto iter = ItemList::iterator_to(items[5]);
+    ASSERT_EQ(iter->value, 5);
+    ASSERT_EQ((iter++)->value, 5);
+    ASSERT_EQ(iter->value, 6);
+
+    // Writes through the iterator land in the caller's object
+    list.begin()->value = 10;
+    ASSERT_EQ(items[0].value, 10);
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, INSERT_ERASE)
+{
+    ItemList list;
+    auto iter = list.insert_after(list.before_begin(), items[0]);
+    iter = list.insert_after(iter, items[2]);
+    ASSERT_EQ(&list.back(), &items[2]);
+    list.insert_after(list.begin(), items[1]);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2}));
+
+    ASSERT_EQ(list.erase_after(list.begin())->value, 2);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 2}));
+
+    // Erasing the last element moves the tail back
+    ASSERT_EQ(list.erase_after(list.begin()), list.end());
+    ASSERT_EQ(&list.back(), &items[0]);
+    list.push_back(items[3]);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 3}));
+
+    list.push_back(items[4]);
+    list.push_back(items[5]);
+    ASSERT_EQ(list.erase_after(list.begin(), ItemList::iterator_to(items[5]))->value, 5);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 5}));
+    ASSERT_EQ(list.erase_after(list.before_begin(), list.end()), list.end());
+    ASSERT_TRUE(list.empty());
+    list.push_back(items[6]);
+    ASSERT_EQ(values_of(list), std::vector<int>({6}));
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, CLEAR)
+{
+    ItemList list;
+    for (auto& item : items)
+    {
+        list.push_front(item);
+    }
+    list.clear();
+    ASSERT_TRUE(list.empty());
+
+    // Cleared objects can be linked again
+    list.push_back(items[7]);
+    list.push_back(items[0]);
+    ASSERT_EQ(values_of(list), std::vector<int>({7, 0}));
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, TWO_HOOKS)
+{
+    ItemList list;
+    OtherItemList other;
+    for (auto& item : items)
+    {
+        list.push_back(item);
+        other.push_front(item);
+    }
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}));
+    ASSERT_EQ(values_of(other), std::vector<int>({7, 6, 5, 4, 3, 2, 1, 0}));
+    ASSERT_EQ(&OtherItemList::iterator_to(items[3])->hook, &items[3].hook);
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, SPLICE_AFTER_LIST)
+{
+    ItemList list;
+    ItemList other;
+    list.push_back(items[0]);
+    list.push_back(items[3]);
+    other.push_back(items[1]);
+    other.push_back(items[2]);
+
+    list.splice_after(list.begin(), other);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2, 3}));
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(&list.back(), &items[3]);
+
+    // Splicing at the tail hands over the other list's tail
+    other.push_back(items[4]);
+    other.push_back(items[5]);
+    list.splice_after(ItemList::iterator_to(items[3]), std::move(other));
+    ASSERT_EQ(&list.back(), &items[5]);
+    list.push_back(items[6]);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2, 3, 4, 5, 6}));
+
+    list.splice_after(list.begin(), other);
+    list.splice_after(list.begin(), list);
+    ASSERT_EQ(list.size(), 7);
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, SPLICE_AFTER_ELEMENT)
+{
+    ItemList list;
+    ItemList other;
+    list.push_back(items[0]);
+    list.push_back(items[2]);
+    other.push_back(items[1]);
+    other.push_back(items[3]);
+
+    list.splice_after(list.begin(), other, other.before_begin());
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2}));
+    ASSERT_EQ(values_of(other), std::vector<int>({3}));
+
+    // Moving other's last element to list's tail updates both tails
+    list.splice_after(ItemList::iterator_to(items[2]), other, other.before_begin());
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(&list.back(), &items[3]);
+    other.push_back(items[4]);
+    ASSERT_EQ(values_of(other), std::vector<int>({4}));
+
+    // Within one list: move the last element to the front
+    list.splice_after(list.before_begin(), list, ItemList::iterator_to(items[2]));
+    ASSERT_EQ(values_of(list), std::vector<int>({3, 0, 1, 2}));
+    ASSERT_EQ(&list.back(), &items[2]);
+
+    // No-ops: element already at pos
+    list.splice_after(list.before_begin(), list, list.before_begin());
+    list.splice_after(list.begin(), list, list.before_begin());
+    ASSERT_EQ(values_of(list), std::vector<int>({3, 0, 1, 2}));
+
+    // Within one list: move the front to the back
+    list.splice_after(ItemList::iterator_to(items[2]), list, list.before_begin());
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2, 3}));
+    ASSERT_EQ(&list.back(), &items[3]);
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, SPLICE_AFTER_RANGE)
+{
+    ItemList list;
+    ItemList other;
+    list.push_back(items[0]);
+    list.push_back(items[4]);
+    for (int index = 1; index < 4; ++index)
+    {
+        other.push_back(items[index]);
+    }
+    other.push_back(items[5]);
+
+    list.splice_after(list.begin(), other, other.before_begin(), ItemList::iterator_to(items[5]));
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2, 3, 4}));
+    ASSERT_EQ(values_of(other), std::vector<int>({5}));
+    ASSERT_EQ(&other.back(), &items[5]);
+
+    // Range ending at end() moves the source tail back
+    other.push_back(items[6]);
+    list.splice_after(ItemList::iterator_to(items[4]), other, other.begin(), other.end());
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 2, 3, 4, 6}));
+    ASSERT_EQ(&list.back(), &items[6]);
+    ASSERT_EQ(&other.back(), &items[5]);
+    other.push_back(items[7]);
+    ASSERT_EQ(values_of(other), std::vector<int>({5, 7}));
+
+    // Within one list
+    list.splice_after(list.before_begin(), list, ItemList::iterator_to(items[3]), list.end());
+    ASSERT_EQ(values_of(list), std::vector<int>({4, 6, 0, 1, 2, 3}));
+    ASSERT_EQ(&list.back(), &items[3]);
+
+    // Empty range
+    list.splice_after(list.begin(), other, other.begin(), ItemList::iterator_to(items[7]));
+    ASSERT_EQ(values_of(other), std::vector<int>({5, 7}));
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, SWAP_MOVE)
+{
+    ItemList list;
+    ItemList other;
+    list.push_back(items[0]);
+    list.push_back(items[1]);
+
+    swap(list, other);
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(values_of(other), std::vector<int>({0, 1}));
+
+    // Both tails must point into their own list after the swap
+    list.push_back(items[2]);
+    other.push_back(items[3]);
+    ASSERT_EQ(values_of(list), std::vector<int>({2}));
+    ASSERT_EQ(values_of(other), std::vector<int>({0, 1, 3}));
+
+    ItemList moved(std::move(other));
+    ASSERT_TRUE(other.empty());
+    moved.push_back(items[4]);
+    ASSERT_EQ(values_of(moved), std::vector<int>({0, 1, 3, 4}));
+
+    list = std::move(moved);
+    ASSERT_TRUE(moved.empty());
+    list.push_back(items[5]);
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 1, 3, 4, 5}));
+}
+
+TEST_F(INTRUSIVE_FORWARD_LIST, REVERSE)
+{
+    ItemList list;
+    list.reverse();
+    ASSERT_TRUE(list.empty());
+
+    for (int index = 0; index < 4; ++index)
+    {
+        list.push_back(items[index]);
+    }
+    list.reverse();
+    ASSERT_EQ(values_of(list), std::vector<int>({3, 2, 1, 0}));
+    ASSERT_EQ(&list.back(), &items[0]);
+    list.push_back(items[4]);
+    ASSERT_EQ(values_of(list), std::vector<int>({3, 2, 1, 0, 4}));
+}
@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "forward_list/UnrolledForwardList.h"
+#include "../Counted.h"
+
+namespace
+{
+template<typename List>
+std::vector<int> values_of(const List& list)
+{
+    std::vector<int> values;
+    for (const auto& elem : list)
+    {
+        values.push_back(elem);
+    }
+    return values;
+}
+}
+
+TEST(UNROLLED_FORWARD_LIST, EMPTY_CREATION)
+{
+    stlcontainer::UnrolledForwardList<int> list;
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.size(), 0);
+    ASSERT_EQ(list.node_count(), 0);
+    ASSERT_EQ(list.begin(), list.end());
+    ASSERT_EQ(++list.before_begin(), list.end());
+}
+
+TEST(UNROLLED_FORWARD_LIST, CONSTRUCTORS)
+{
+    stlcontainer::UnrolledForwardList<int, 4> fill(10, 3);
+    ASSERT_EQ(values_of(fill), std::vector<int>(10, 3));
+    ASSERT_EQ(fill.node_count(), 3);
+
+    stlcontainer::UnrolledForwardList<int, 4> list = {1, 2, 3, 4, 5};
+    ASSERT_EQ(list.front(), 1);
+    ASSERT_EQ(list.size(), 5);
+
+    auto copy = list;
+    ASSERT_EQ(values_of(copy), values_of(list));
+
+    auto moved = std::move(copy);
+    ASSERT_EQ(values_of(moved), std::vector<int>({1, 2, 3, 4, 5}));
+    ASSERT_TRUE(copy.empty());
+
+    copy = {7, 8};
+    moved = copy;
+    ASSERT_EQ(values_of(moved), std::vector<int>({7, 8}));
+}
+
+TEST(UNROLLED_FORWARD_LIST, PACKED_NODES)
+{
+    // Appending in order behind the last element fills every node before starting the next
+    stlcontainer::UnrolledForwardList<int, 8> list;
+    auto iter = list.before_begin();
+    for (int index = 0; index < 64; ++index)
+    {
+        iter = list.insert_after(iter, index);
+    }
+    ASSERT_EQ(list.node_count(), 8);
+    ASSERT_EQ(*iter, 63);
+    ASSERT_EQ(std::distance(list.begin(), list.end()), 64);
+}
+
+TEST(UNROLLED_FORWARD_LIST, INSERT_SPLITS)
+{
+    stlcontainer::UnrolledForwardList<int, 4> list = {1, 2, 3, 4};
+    ASSERT_EQ(list.node_count(), 1);
+
+    auto iter = list.insert_after(list.begin(), 10);
+    ASSERT_EQ(*iter, 10);
+    ASSERT_EQ(list.node_count(), 2);
+    ASSERT_EQ(values_of(list), std::vector<int>({1, 10, 2, 3, 4}));
+
+    list.push_front(0);
+    list.emplace_front(-1);
+    ASSERT_EQ(values_of(list), std::vector<int>({-1, 0, 1, 10, 2, 3, 4}));
+    ASSERT_EQ(list.size(), 7);
+}
+
+TEST(UNROLLED_FORWARD_LIST, INSERT_THROUGH_SAME_ITERATOR_ACROSS_SPLIT)
+{
+    // pos in the half that stays: it survives the split and can be reused
+    stlcontainer::UnrolledForwardList<int, 4> lower = {1, 2, 3, 4};
+    auto pos = std::next(lower.begin(), 1);
+    lower.insert_after(pos, 10);
+    ASSERT_EQ(lower.node_count(), 2);
+    lower.insert_after(pos, 20);
+    ASSERT_EQ(*pos, 2);
+    ASSERT_EQ(values_of(lower), std::vector<int>({1, 2, 20, 10, 3, 4}));
+
+    // pos in the half that moves: the returned iterator is the one to keep inserting through
+    stlcontainer::UnrolledForwardList<int, 4> upper = {1, 2, 3, 4};
+    pos = std::next(upper.begin(), 2);
+    pos = upper.insert_after(pos, 10);
+    ASSERT_EQ(upper.node_count(), 2);
+    pos = upper.insert_after(pos, 20);
+    pos = upper.insert_after(pos, 30);
+    ASSERT_EQ(*pos, 30);
+    ASSERT_EQ(values_of(upper), std::vector<int>({1, 2, 3, 10, 20, 30, 4}));
+    ASSERT_EQ(upper.size(), 7);
+}
+
+TEST(UNROLLED_FORWARD_LIST, ERASE_MERGES)
+{
+    stlcontainer::UnrolledForwardList<int, 4> list = {0, 1, 2, 3, 4, 5, 6, 7};
+    ASSERT_EQ(list.node_count(), 2);
+
+    auto iter = list.erase_after(list.begin());
+    ASSERT_EQ(*iter, 2);
+    iter = list.erase_after(list.begin());
+    ASSERT_EQ(*iter, 3);
+    ASSERT_EQ(list.node_count(), 2);
+
+    // First node now holds 0, 3 and fits the second one's 4 elements after one more erase
+    list.erase_after(list.begin(), std::next(list.begin(), 3));
+    ASSERT_EQ(values_of(list), std::vector<int>({0, 5, 6, 7}));
+    ASSERT_EQ(list.node_count(), 1);
+
+    list.erase_after(list.before_begin(), list.end());
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.node_count(), 0);
+}
+
+TEST(UNROLLED_FORWARD_LIST, ERASE_RANGE_ACROSS_NODES)
+{
+    stlcontainer::UnrolledForwardList<int, 4> list;
+    std::forward_list<int> listCompare;
+    for (int index = 19; index >= 0; --index)
+    {
+        list.push_front(index);
+        listCompare.push_front(index);
+    }
+
+    auto iter = list.erase_after(std::next(list.begin(), 2), std::next(list.begin(), 15));
+    auto compareIter = listCompare.erase_after(std::next(listCompare.begin(), 2), std::next(listCompare.begin(), 15));
+    ASSERT_EQ(*iter, *compareIter);
+    ASSERT_EQ(values_of(list), std::vector<int>(listCompare.begin(), listCompare.end()));
+    ASSERT_EQ(list.size(), 8);
+}
+
+TEST(UNROLLED_FORWARD_LIST, RANDOM_OPERATIONS)
+{
+    stlcontainer::UnrolledForwardList<int, 5> list;
+    std::forward_list<int> listCompare;
+    size_t size = 0;
+    std::mt19937 gen(7);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        auto offset = size ? gen() % (size + 1) : 0;
+        auto pos = std::next(list.before_begin(), offset);
+        auto comparePos = std::next(listCompare.before_begin(), offset);
+        auto action = gen() % 8;
+
+        if (action < 4 || size == 0)
+        {
+            auto iter = list.insert_after(pos, step);
+            listCompare.insert_after(comparePos, step);
+            ASSERT_EQ(*iter, step);
+            ++size;
+        }
+        else if (action < 7 && offset < size)
+        {
+            size_t count = 1 + gen() % 6;
+            count = std::min(count, size - offset);
+            auto iter = list.erase_after(pos, std::next(pos, count + 1));
+            auto compareIter = listCompare.erase_after(comparePos, std::next(comparePos, count + 1));
+            size -= count;
+            ASSERT_EQ(iter == list.end(), compareIter == listCompare.end());
+        }
+        else if (offset < size)
+        {
+            auto iter = list.erase_after(pos);
+            auto compareIter = listCompare.erase_after(comparePos);
+            ASSERT_EQ(iter == list.end(), compareIter == listCompare.end());
+            if (iter != list.end())
+            {
+                ASSERT_EQ(*iter, *compareIter);
+            }
+            --size;
+        }
+        ASSERT_EQ(list.size(), size);
+    }
+    ASSERT_EQ(values_of(list), std::vector<int>(listCompare.begin(), listCompare.end()));
+    ASSERT_LE(list.node_count(), 2 * list.size() / 5 + 2);
+}
+
+TEST(UNROLLED_FORWARD_LIST, DESTROYS_VALUES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::UnrolledForwardList<Counted, 3> list;
+        for (int index = 0; index < 20; ++index)
+        {
+            list.insert_after(list.before_begin(), index);
+        }
+        list.erase_after(list.begin(), std::next(list.begin(), 10));
+        list.pop_front();
+        ASSERT_EQ(Counted::live, static_cast<int>(list.size()));
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(UNROLLED_FORWARD_LIST, STRINGS)
+{
+    stlcontainer::UnrolledForwardList<std::string, 2> list = {"a", "b", "c"};
+    list.emplace_after(list.begin(), 3, 'x');
+    list.insert_after(list.before_begin(), list.front());
+    ASSERT_EQ(std::vector<std::string>(list.begin(), list.end()),
+        std::vector<std::string>({"a", "a", "xxx", "b", "c"}));
+}
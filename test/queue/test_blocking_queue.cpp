@@ -0,0 +1,263 @@
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/BlockingQueue.h"
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <exception>
+#include <optional>
+#endif
+
+namespace
+{
+#if defined(__cpp_impl_coroutine)
+// Fire-and-forget coroutine, runs eagerly and frees itself when it finishes
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+// Pops until the queue is closed and drained, appending every value to received
+Detached consume(stlcontainer::BlockingQueue<int>& queue, std::vector<int>& received, bool& finished)
+{
+    while (auto value = co_await queue.async_pop())
+    {
+        received.push_back(*value);
+    }
+    finished = true;
+}
+#endif
+}
+
+TEST(BLOCKING_QUEUE, EMPTY_CREATION)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+    ASSERT_FALSE(queue.is_closed());
+
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(BLOCKING_QUEUE, FIFO_ORDER)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    for (int index = 0; index < 5; ++index)
+    {
+        ASSERT_TRUE(queue.push(index));
+    }
+    ASSERT_EQ(queue.size(), 5);
+
+    int value = -1;
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_EQ(queue.pop_for(value, std::chrono::milliseconds(0)), stlcontainer::queue_op_status::success);
+    ASSERT_EQ(value, 2);
+    ASSERT_EQ(queue.size(), 2);
+}
+
+TEST(BLOCKING_QUEUE, MOVE_ONLY)
+{
+    stlcontainer::BlockingQueue<std::unique_ptr<int>> queue;
+    ASSERT_TRUE(queue.push(std::unique_ptr<int>(new int(7))));
+    ASSERT_TRUE(queue.emplace(new int(8)));
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(*value, 7);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(*value, 8);
+}
+
+TEST(BLOCKING_QUEUE, POP_FOR_TIMEOUT)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    int value = -1;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(queue.pop_for(value, std::chrono::milliseconds(20)), stlcontainer::queue_op_status::timeout);
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    ASSERT_EQ(value, -1);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(5);
+    ASSERT_EQ(queue.pop_until(value, deadline), stlcontainer::queue_op_status::timeout);
+}
+
+TEST(BLOCKING_QUEUE, POP_WAKES_ON_PUSH)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    std::thread producer([&queue] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.push(42);
+    });
+
+    int value = 0;
+    ASSERT_EQ(queue.pop_for(value, std::chrono::seconds(10)), stlcontainer::queue_op_status::success);
+    ASSERT_EQ(value, 42);
+    producer.join();
+}
+
+TEST(BLOCKING_QUEUE, CLOSE_KEEPS_QUEUED)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    queue.push(1);
+    queue.push(2);
+    queue.close();
+    ASSERT_TRUE(queue.is_closed());
+    ASSERT_FALSE(queue.push(3));
+    ASSERT_EQ(queue.size(), 2);
+
+    int value = 0;
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_EQ(queue.pop_for(value, std::chrono::seconds(10)), stlcontainer::queue_op_status::success);
+    ASSERT_EQ(value, 2);
+
+    // Closed and drained: no waiting
+    ASSERT_FALSE(queue.pop(value));
+    ASSERT_EQ(queue.pop_for(value, std::chrono::seconds(10)), stlcontainer::queue_op_status::closed);
+    ASSERT_EQ(value, 2);
+}
+
+TEST(BLOCKING_QUEUE, CLOSE_WAKES_WAITERS)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    std::atomic<int> woken{0};
+    std::vector<std::thread> consumers;
+    for (int index = 0; index < 3; ++index)
+    {
+        consumers.emplace_back([&queue, &woken] {
+            int value = 0;
+            if (!queue.pop(value))
+            {
+                woken.fetch_add(1);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+    ASSERT_EQ(woken.load(), 3);
+}
+
+TEST(BLOCKING_QUEUE, DRAIN)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    for (int index = 0; index < 4; ++index)
+    {
+        queue.push(index);
+    }
+    std::vector<int> drained;
+    ASSERT_EQ(queue.drain(std::back_inserter(drained)), 4);
+    ASSERT_EQ(drained, std::vector<int>({0, 1, 2, 3}));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.drain(std::back_inserter(drained)), 0);
+}
+
+TEST(BLOCKING_QUEUE, PRODUCERS_CONSUMERS)
+{
+    // Consumers run until close: the shutdown pattern the queue is meant for
+    const int PER_PRODUCER = 20000;
+    stlcontainer::BlockingQueue<int> queue;
+    std::atomic<long> sum{0};
+    std::atomic<int> count{0};
+
+    std::vector<std::thread> consumers;
+    for (int index = 0; index < 4; ++index)
+    {
+        consumers.emplace_back([&] {
+            int value = 0;
+            while (queue.pop(value))
+            {
+                sum.fetch_add(value);
+                count.fetch_add(1);
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (int index = 0; index < 4; ++index)
+    {
+        producers.emplace_back([&queue] {
+            for (int value = 0; value < PER_PRODUCER; ++value)
+            {
+                queue.push(value);
+            }
+        });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    queue.close();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    ASSERT_EQ(count.load(), 4 * PER_PRODUCER);
+    ASSERT_EQ(sum.load(), 4L * PER_PRODUCER * (PER_PRODUCER - 1) / 2);
+}
+
+#if defined(__cpp_impl_coroutine)
+TEST(BLOCKING_QUEUE, ASYNC_POP)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    queue.push(1);
+
+    // Takes the queued element without suspending, then suspends on the empty queue
+    std::vector<int> received;
+    bool finished = false;
+    consume(queue, received, finished);
+    ASSERT_EQ(received, std::vector<int>({1}));
+
+    // Each push resumes the coroutine on this thread before returning
+    queue.push(2);
+    queue.push(3);
+    ASSERT_EQ(received, std::vector<int>({1, 2, 3}));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(finished);
+
+    queue.close();
+    ASSERT_TRUE(finished);
+}
+
+TEST(BLOCKING_QUEUE, ASYNC_POP_FIFO_WAITERS)
+{
+    stlcontainer::BlockingQueue<int> queue;
+    std::vector<int> first;
+    std::vector<int> second;
+    bool firstFinished = false;
+    bool secondFinished = false;
+    consume(queue, first, firstFinished);
+    consume(queue, second, secondFinished);
+
+    // The oldest suspended coroutine gets the element, and queues behind the other one again
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+    ASSERT_EQ(first, std::vector<int>({1, 3}));
+    ASSERT_EQ(second, std::vector<int>({2}));
+
+    queue.close();
+    ASSERT_TRUE(firstFinished);
+    ASSERT_TRUE(secondFinished);
+}
+#endif
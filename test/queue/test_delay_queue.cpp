@@ -0,0 +1,293 @@
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/DelayQueue.h"
+#include "../Counted.h"
+
+namespace
+{
+// Clock that only moves when a test sets it
+struct ManualClock
+{
+    using duration =    std::chrono::milliseconds;
+    using rep =         duration::rep;
+    using period =      duration::period;
+    using time_point =  std::chrono::time_point<ManualClock>;
+    static const bool is_steady = true;
+
+    static time_point current;
+
+    static time_point now() noexcept
+    {
+        return current;
+    }
+};
+ManualClock::time_point ManualClock::current;
+
+using DelayQueue = stlcontainer::DelayQueue<int, ManualClock>;
+using std::chrono::milliseconds;
+
+ManualClock::time_point at(long ms)
+{
+    return ManualClock::time_point(milliseconds(ms));
+}
+
+// Advances to ms and returns what fired, in firing order
+std::vector<int> advance_to(DelayQueue& queue, long ms)
+{
+    std::vector<int> fired;
+    auto count = queue.advance(at(ms), [&fired](int value) { fired.push_back(value); });
+    EXPECT_EQ(count, fired.size());
+    return fired;
+}
+
+}
+
+TEST(DELAY_QUEUE, EMPTY_CREATION)
+{
+    DelayQueue queue(milliseconds(1), at(0));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+    ASSERT_TRUE(advance_to(queue, 1000000).empty());
+    ASSERT_TRUE(queue.now() == at(1000000));
+}
+
+TEST(DELAY_QUEUE, FIRES_AT_DEADLINE)
+{
+    // Deadlines on both sides of every level boundary
+    std::vector<long> deadlines = {1, 5, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 300000, 20000000};
+    DelayQueue queue(milliseconds(1), at(0));
+    for (auto index = deadlines.size(); index-- > 0;)
+    {
+        queue.schedule(at(deadlines[index]), static_cast<int>(deadlines[index]));
+    }
+    ASSERT_EQ(queue.size(), deadlines.size());
+
+    for (auto deadline : deadlines)
+    {
+        ASSERT_TRUE(advance_to(queue, deadline - 1).empty()) << deadline;
+        ASSERT_EQ(advance_to(queue, deadline), std::vector<int>({static_cast<int>(deadline)}));
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(DELAY_QUEUE, ONE_ADVANCE_IN_ORDER)
+{
+    DelayQueue queue(milliseconds(1), at(0));
+    std::vector<int> expected;
+    for (int value = 1000; value > 0; --value)
+    {
+        queue.schedule(at(value * 37), value);
+        expected.insert(expected.begin(), value);
+    }
+    ASSERT_EQ(advance_to(queue, 37000), expected);
+}
+
+TEST(DELAY_QUEUE, ROUNDS_UP_TO_TICK)
+{
+    DelayQueue queue(milliseconds(10), at(0));
+    queue.schedule(at(15), 15);
+    queue.schedule(at(20), 20);
+    ASSERT_TRUE(advance_to(queue, 19).empty());
+    ASSERT_EQ(advance_to(queue, 20), std::vector<int>({15, 20}));
+}
+
+TEST(DELAY_QUEUE, PAST_DEADLINE_AND_SCHEDULE_AFTER)
+{
+    DelayQueue queue(milliseconds(1), at(0));
+    advance_to(queue, 500);
+    queue.schedule(at(100), 1);
+    queue.schedule_after(milliseconds(0), 2);
+    queue.schedule_after(milliseconds(10), 3);
+    ASSERT_EQ(advance_to(queue, 500), std::vector<int>({1, 2}));
+    ASSERT_EQ(advance_to(queue, 510), std::vector<int>({3}));
+
+    // Time going backwards fires nothing and keeps the wheel where it was
+    queue.schedule(at(520), 4);
+    ASSERT_TRUE(advance_to(queue, 0).empty());
+    ASSERT_TRUE(queue.now() == at(510));
+}
+
+TEST(DELAY_QUEUE, CANCEL)
+{
+    DelayQueue queue(milliseconds(1), at(0));
+    auto first = queue.schedule(at(10), 1);
+    auto second = queue.schedule(at(5000), 2);
+    auto third = queue.schedule(at(10), 3);
+
+    ASSERT_TRUE(queue.cancel(second));
+    ASSERT_FALSE(queue.cancel(second));
+    ASSERT_EQ(queue.size(), 2);
+    ASSERT_TRUE(queue.cancel(third));
+    ASSERT_EQ(advance_to(queue, 10000), std::vector<int>({1}));
+    ASSERT_FALSE(queue.cancel(first));
+
+    // A reused node does not answer to the old handle
+    auto reused = queue.schedule(at(20000), 4);
+    ASSERT_FALSE(queue.cancel(first));
+    ASSERT_TRUE(queue.cancel(reused));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(DELAY_QUEUE, CANCEL_THEN_CASCADE)
+{
+    // Entries at 100 ms sit in a level-1 slot until the cascade at 64 ms moves their records down
+    Counted::live = 0;
+    {
+        stlcontainer::DelayQueue<Counted, ManualClock> queue(milliseconds(1), at(0));
+        auto cancelled = queue.schedule(at(100), 1);
+        queue.schedule(at(130), 2);
+        ASSERT_TRUE(queue.cancel(cancelled));
+        ASSERT_EQ(Counted::live, 1);
+
+        ASSERT_EQ(queue.advance(at(70), [](Counted) {}), 0);
+        ASSERT_EQ(Counted::live, 1);
+        ASSERT_EQ(queue.size(), 1);
+    }
+    ASSERT_EQ(Counted::live, 0);
+
+    // Same with a value that owns memory, and with the cancelled node reused before the cascade
+    stlcontainer::DelayQueue<std::string, ManualClock> queue(milliseconds(1), at(0));
+    auto cancelled = queue.schedule(at(100), std::string(64, 'a'));
+    ASSERT_TRUE(queue.cancel(cancelled));
+    queue.schedule(at(110), std::string(64, 'b'));
+    std::vector<std::string> fired;
+    queue.advance(at(70), [&fired](std::string value) { fired.push_back(std::move(value)); });
+    ASSERT_TRUE(fired.empty());
+    queue.advance(at(200), [&fired](std::string value) { fired.push_back(std::move(value)); });
+    ASSERT_EQ(fired, std::vector<std::string>({std::string(64, 'b')}));
+    queue.schedule(at(300), std::string(64, 'c'));
+    auto stale = queue.schedule(at(400), std::string(64, 'd'));
+    queue.cancel(stale);
+    queue.advance(at(260), [](std::string) {});
+}
+
+TEST(DELAY_QUEUE, CALLBACKS_SCHEDULE_AND_CANCEL)
+{
+    DelayQueue queue(milliseconds(1), at(0));
+    queue.schedule(at(100), 1);
+    auto victim = queue.schedule(at(100), 99);
+    std::vector<int> fired;
+    queue.advance(at(100), [&](int value) {
+        fired.push_back(value);
+        if (value == 1)
+        {
+            // Due now: fires in this call. Due later: waits.
+            queue.schedule(at(50), 2);
+            queue.schedule(at(101), 3);
+            queue.cancel(victim);
+        }
+    });
+    // The victim was due in the same batch but had not fired yet
+    ASSERT_EQ(fired, std::vector<int>({1, 2}));
+    ASSERT_EQ(advance_to(queue, 101), std::vector<int>({3}));
+}
+
+TEST(DELAY_QUEUE, BEYOND_THE_WHEEL)
+{
+    // 2^36 ticks of 1ms is about 795 days; these wait on the overflow list
+    const long DAY = 24L * 3600 * 1000;
+    DelayQueue queue(milliseconds(1), at(0));
+    queue.schedule(at(2000 * DAY), 2);
+    queue.schedule(at(900 * DAY), 1);
+    queue.schedule(at(5), 0);
+
+    ASSERT_EQ(advance_to(queue, 10), std::vector<int>({0}));
+    ASSERT_TRUE(advance_to(queue, 900 * DAY - 1).empty());
+    ASSERT_EQ(advance_to(queue, 900 * DAY), std::vector<int>({1}));
+    ASSERT_TRUE(advance_to(queue, 2000 * DAY - 1).empty());
+    ASSERT_EQ(advance_to(queue, 2000 * DAY), std::vector<int>({2}));
+}
+
+TEST(DELAY_QUEUE, RANDOM_OPERATIONS)
+{
+    // Against a multimap from deadline to value; checks each advance fires exactly the due entries, in order
+    std::mt19937 random(11);
+    DelayQueue queue(milliseconds(1), at(0));
+    std::multimap<long, int> pending;
+    std::map<int, DelayQueue::handle_type> handles;
+    long now = 0;
+    int nextValue = 0;
+
+    for (int round = 0; round < 20000; ++round)
+    {
+        auto operation = random() % 10;
+        if (operation < 6)
+        {
+            // Mostly near deadlines, some far
+            long span = random() % 4 == 0 ? 1000000 : 300;
+            long deadline = now + static_cast<long>(random() % span) - 10;
+            handles[nextValue] = queue.schedule(at(deadline), nextValue);
+            pending.insert({std::max(deadline, now), nextValue++});
+        }
+        else if (operation < 8 && !handles.empty())
+        {
+            auto pick = handles.begin();
+            std::advance(pick, random() % handles.size());
+            ASSERT_TRUE(queue.cancel(pick->second));
+            for (auto entry = pending.begin(); entry != pending.end(); ++entry)
+            {
+                if (entry->second == pick->first)
+                {
+                    pending.erase(entry);
+                    break;
+                }
+            }
+            handles.erase(pick);
+        }
+        else
+        {
+            now += random() % 3 == 0 ? static_cast<long>(random() % 100000) : static_cast<long>(random() % 50);
+            auto fired = advance_to(queue, now);
+            std::vector<long> firedDeadlines;
+            for (auto value : fired)
+            {
+                auto entry = std::find_if(pending.begin(), pending.end(),
+                    [value](const std::pair<const long, int>& item) { return item.second == value; });
+                ASSERT_TRUE(entry != pending.end());
+                ASSERT_LE(entry->first, now);
+                firedDeadlines.push_back(entry->first);
+                pending.erase(entry);
+                handles.erase(value);
+            }
+            ASSERT_TRUE(std::is_sorted(firedDeadlines.begin(), firedDeadlines.end()));
+            ASSERT_TRUE(pending.empty() || pending.begin()->first > now);
+        }
+        ASSERT_EQ(queue.size(), pending.size());
+    }
+}
+
+TEST(DELAY_QUEUE, CLOCK_NOW_AND_DESTRUCTOR)
+{
+    Counted::live = 0;
+    ManualClock::current = at(1000);
+    {
+        stlcontainer::DelayQueue<Counted, ManualClock> queue;
+        queue.schedule_after(milliseconds(5), 1);
+        queue.schedule_after(milliseconds(50), 2);
+        queue.schedule_after(milliseconds(5000000), 3);
+        ASSERT_EQ(Counted::live, 3);
+
+        ManualClock::current = at(1010);
+        int fired = 0;
+        queue.advance([&fired](Counted value) { fired = value.value; });
+        ASSERT_EQ(fired, 1);
+        ASSERT_EQ(Counted::live, 2);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(DELAY_QUEUE, MOVE_ONLY)
+{
+    stlcontainer::DelayQueue<std::unique_ptr<int>, ManualClock> queue(milliseconds(1), at(0));
+    queue.schedule(at(3), new int(3));
+    int fired = 0;
+    queue.advance(at(3), [&fired](std::unique_ptr<int> value) { fired = *value; });
+    ASSERT_EQ(fired, 3);
+}
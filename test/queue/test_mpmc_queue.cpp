@@ -0,0 +1,302 @@
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/MPMCQueue.h"
+#include "../Counted.h"
+
+namespace
+{
+// Producer id in the high bits, per-producer sequence in the low bits
+const int SEQUENCE_BITS = 20;
+
+int encode(int producer, int sequence)
+{
+    return (producer << SEQUENCE_BITS) | sequence;
+}
+}
+
+TEST(MPMC_QUEUE, EMPTY_CREATION)
+{
+    stlcontainer::MPMCQueue<int> queue(8);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+    ASSERT_EQ(queue.capacity(), 8);
+
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(MPMC_QUEUE, CAPACITY_POWER_OF_TWO)
+{
+    // The sequence scheme needs at least two slots
+    ASSERT_EQ(stlcontainer::MPMCQueue<int>(0).capacity(), 2);
+    ASSERT_EQ(stlcontainer::MPMCQueue<int>(1).capacity(), 2);
+    ASSERT_EQ(stlcontainer::MPMCQueue<int>(5).capacity(), 8);
+    ASSERT_EQ(stlcontainer::MPMCQueue<int>(1024).capacity(), 1024);
+    ASSERT_EQ(stlcontainer::MPMCQueue<int>(1025).capacity(), 2048);
+}
+
+TEST(MPMC_QUEUE, PUSH_POP_FULL)
+{
+    stlcontainer::MPMCQueue<int> queue(4);
+    for (int index = 0; index < 4; ++index)
+    {
+        ASSERT_TRUE(queue.try_push(index));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+    ASSERT_EQ(queue.size(), 4);
+
+    int value = -1;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(queue.try_push(4));
+    ASSERT_FALSE(queue.try_push(5));
+
+    for (int expected = 1; expected <= 4; ++expected)
+    {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, expected);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(MPMC_QUEUE, WRAP_AROUND)
+{
+    stlcontainer::MPMCQueue<int> queue(8);
+    int nextPush = 0;
+    int nextPop = 0;
+    for (int round = 0; round < 1000; ++round)
+    {
+        for (int index = 0; index < round % 8 + 1; ++index)
+        {
+            ASSERT_TRUE(queue.try_push(nextPush++));
+        }
+        int value = 0;
+        while (queue.try_pop(value))
+        {
+            ASSERT_EQ(value, nextPop++);
+        }
+    }
+    ASSERT_EQ(nextPop, nextPush);
+}
+
+TEST(MPMC_QUEUE, BULK_PUSH_POP)
+{
+    stlcontainer::MPMCQueue<int> queue(8);
+    std::vector<int> input = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // Only as many as there are free slots
+    ASSERT_EQ(queue.try_push_n(input.begin(), 3), 3);
+    ASSERT_EQ(queue.try_push_n(input.begin() + 3, 7), 5);
+    ASSERT_EQ(queue.try_push_n(input.begin() + 8, 2), 0);
+    ASSERT_EQ(queue.size(), 8);
+
+    std::vector<int> output;
+    ASSERT_EQ(queue.try_pop_n(std::back_inserter(output), 5), 5);
+    ASSERT_EQ(queue.try_push_n(input.begin() + 8, 2), 2);
+    ASSERT_EQ(queue.try_pop_n(std::back_inserter(output), 100), 5);
+    ASSERT_EQ(queue.try_pop_n(std::back_inserter(output), 100), 0);
+    ASSERT_EQ(output, input);
+
+    // Blocking forms on a queue that has room or data
+    queue.push_n(input.begin(), 4);
+    output.clear();
+    ASSERT_EQ(queue.pop_n(std::back_inserter(output), 10), 4);
+    ASSERT_EQ(output, std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST(MPMC_QUEUE, PUSH_N_FROM_SINGLE_PASS_ITERATOR)
+{
+    // Ten values through a queue of four take several batches; each value must be read from the stream once
+    stlcontainer::MPMCQueue<int> queue(4);
+    std::istringstream stream("0 1 2 3 4 5 6 7 8 9 10");
+    std::vector<int> output;
+    std::thread consumer([&] {
+        while (output.size() < 10)
+        {
+            queue.pop_n(std::back_inserter(output), 10 - output.size());
+        }
+    });
+    queue.push_n(std::istream_iterator<int>(stream), 10);
+    consumer.join();
+
+    ASSERT_EQ(output, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    int rest = 0;
+    ASSERT_TRUE(stream >> rest);
+    ASSERT_EQ(rest, 10);
+}
+
+TEST(MPMC_QUEUE, EMPLACE_MOVE_ONLY)
+{
+    stlcontainer::MPMCQueue<std::string> strings(2);
+    ASSERT_TRUE(strings.try_emplace(3, 'a'));
+    strings.emplace("b");
+    std::string text;
+    strings.pop(text);
+    ASSERT_EQ(text, "aaa");
+    strings.pop(text);
+    ASSERT_EQ(text, "b");
+
+    stlcontainer::MPMCQueue<std::unique_ptr<int>> pointers(2);
+    pointers.push(std::unique_ptr<int>(new int(7)));
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(pointers.try_pop(value));
+    ASSERT_EQ(*value, 7);
+}
+
+TEST(MPMC_QUEUE, DESTRUCTOR_FREES_VALUES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::MPMCQueue<Counted> queue(4);
+        for (int index = 0; index < 3; ++index)
+        {
+            queue.try_emplace(index);
+        }
+        Counted value;
+        queue.try_pop(value);
+        ASSERT_EQ(Counted::live, 3);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(MPMC_QUEUE, BLOCKED_POP_WOKEN_BY_PUSH)
+{
+    stlcontainer::MPMCQueue<int> queue(2);
+    std::atomic<bool> received(false);
+    int value = 0;
+
+    std::thread consumer([&] {
+        queue.pop(value);
+        received.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(received.load());
+    queue.push(42);
+    consumer.join();
+    ASSERT_EQ(value, 42);
+}
+
+TEST(MPMC_QUEUE, BLOCKED_PUSH_WOKEN_BY_POP)
+{
+    stlcontainer::MPMCQueue<int> queue(2);
+    queue.push(0);
+    queue.push(1);
+    std::atomic<bool> pushed(false);
+
+    std::thread producer([&] {
+        queue.push(2);
+        pushed.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(pushed.load());
+    int value = -1;
+    queue.pop(value);
+    producer.join();
+    ASSERT_EQ(value, 0);
+    ASSERT_EQ(queue.size(), 2);
+}
+
+TEST(MPMC_QUEUE, PRODUCERS_CONSUMERS)
+{
+    // Four producers and four consumers over a small ring, each thread mixing the try, blocking and bulk
+    // forms. Every value must arrive exactly once, and each consumer must see any one producer's values in
+    // the order they were pushed.
+    const int THREADS = 4;
+    const int PER_PRODUCER = 20000;
+    const int BATCH = 8;
+    stlcontainer::MPMCQueue<int> queue(16);
+    std::atomic<int> remaining(THREADS * PER_PRODUCER);
+    std::vector<std::vector<int>> received(THREADS);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < THREADS; ++producer)
+    {
+        threads.emplace_back([&queue, producer, PER_PRODUCER, BATCH] {
+            int sequence = 0;
+            while (sequence < PER_PRODUCER)
+            {
+                switch (sequence % 3)
+                {
+                case 0:
+                    while (!queue.try_push(encode(producer, sequence)))
+                    {
+                        std::this_thread::yield();
+                    }
+                    ++sequence;
+                    break;
+                case 1:
+                    queue.push(encode(producer, sequence++));
+                    break;
+                default:
+                {
+                    int batch[BATCH];
+                    int count = std::min(BATCH, PER_PRODUCER - sequence);
+                    for (int index = 0; index < count; ++index)
+                    {
+                        batch[index] = encode(producer, sequence++);
+                    }
+                    queue.push_n(batch, count);
+                }
+                }
+            }
+        });
+    }
+    for (int consumer = 0; consumer < THREADS; ++consumer)
+    {
+        threads.emplace_back([&queue, &remaining, &received, consumer, BATCH] {
+            auto& values = received[consumer];
+            int turn = 0;
+            while (remaining.load() > 0)
+            {
+                int batch[BATCH];
+                size_t count = 0;
+                if (turn++ % 2 == 0)
+                {
+                    count = queue.try_pop_n(batch, BATCH);
+                }
+                else if (queue.try_pop(batch[0]))
+                {
+                    count = 1;
+                }
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                values.insert(values.end(), batch, batch + count);
+                remaining.fetch_sub(static_cast<int>(count));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<int> all;
+    for (auto& values : received)
+    {
+        std::vector<int> lastSequence(THREADS, -1);
+        for (auto value : values)
+        {
+            int producer = value >> SEQUENCE_BITS;
+            int sequence = value & ((1 << SEQUENCE_BITS) - 1);
+            ASSERT_GT(sequence, lastSequence[producer]);
+            lastSequence[producer] = sequence;
+        }
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(THREADS * PER_PRODUCER));
+    ASSERT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+    ASSERT_TRUE(queue.empty());
+}
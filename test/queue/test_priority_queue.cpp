@@ -0,0 +1,311 @@
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/IndexedPriorityQueue.h"
+#include "queue/PriorityQueue.h"
+
+namespace
+{
+// Pops everything, in priority order
+template<typename QueueType>
+std::vector<int> drain(QueueType& queue)
+{
+    std::vector<int> values;
+    while (!queue.empty())
+    {
+        values.push_back(queue.top());
+        queue.pop();
+    }
+    return values;
+}
+
+template<typename Compare>
+std::vector<int> drain(std::priority_queue<int, std::vector<int>, Compare>& queue)
+{
+    std::vector<int> values;
+    while (!queue.empty())
+    {
+        values.push_back(queue.top());
+        queue.pop();
+    }
+    return values;
+}
+}
+
+TEST(PRIORITY_QUEUE, EMPTY_CREATION)
+{
+    stlcontainer::PriorityQueue<int> queue;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(PRIORITY_QUEUE, PUSH_POP_MATCHES_STD)
+{
+    std::mt19937 random(42);
+    stlcontainer::PriorityQueue<int> queue;
+    std::priority_queue<int> queueCompare;
+    for (int round = 0; round < 20000; ++round)
+    {
+        if (random() % 3 != 0 || queue.empty())
+        {
+            int value = static_cast<int>(random() % 1000);
+            queue.push(value);
+            queueCompare.push(value);
+        }
+        else
+        {
+            queue.pop();
+            queueCompare.pop();
+        }
+        ASSERT_EQ(queue.size(), queueCompare.size());
+        if (!queue.empty())
+        {
+            ASSERT_EQ(queue.top(), queueCompare.top());
+        }
+    }
+    ASSERT_EQ(drain(queue), drain(queueCompare));
+}
+
+TEST(PRIORITY_QUEUE, MIN_HEAP_AND_ARITY)
+{
+    std::vector<int> values;
+    std::mt19937 random(7);
+    for (int index = 0; index < 500; ++index)
+    {
+        values.push_back(static_cast<int>(random() % 100));
+    }
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    stlcontainer::PriorityQueue<int, std::greater<int>, std::vector<int>, 2> binary;
+    stlcontainer::PriorityQueue<int, std::greater<int>> quaternary;
+    stlcontainer::PriorityQueue<int, std::greater<int>, std::deque<int>, 8> octal;
+    for (auto value : values)
+    {
+        binary.push(value);
+        quaternary.push(value);
+        octal.push(value);
+    }
+    ASSERT_EQ(drain(binary), sorted);
+    ASSERT_EQ(drain(quaternary), sorted);
+    ASSERT_EQ(drain(octal), sorted);
+}
+
+TEST(PRIORITY_QUEUE, BULK_CONSTRUCTION)
+{
+    std::vector<int> values = {5, 1, 9, 3, 7, 2, 8, 6, 4, 0};
+    std::vector<int> descending = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+
+    stlcontainer::PriorityQueue<int> fromRange(values.begin(), values.end());
+    ASSERT_EQ(drain(fromRange), descending);
+
+    // The default container is stlcontainer::Vector, whose iterator has no operator[]
+    static_assert(std::is_same<stlcontainer::PriorityQueue<int>::container_type, stlcontainer::Vector<int>>::value,
+        "PriorityQueue defaults to stlcontainer::Vector");
+    stlcontainer::Vector<int> container = {5, 1, 9, 3, 7, 2, 8, 6, 4, 0};
+    stlcontainer::PriorityQueue<int, std::less<int>, stlcontainer::Vector<int>> fromContainer(std::less<int>{}, container);
+    ASSERT_EQ(drain(fromContainer), descending);
+
+    stlcontainer::PriorityQueue<int> fromMoved(std::less<int>{}, stlcontainer::Vector<int>(container));
+    ASSERT_EQ(drain(fromMoved), descending);
+
+    stlcontainer::PriorityQueue<int, std::less<int>, std::vector<int>> fromStdVector(std::less<int>{}, values);
+    ASSERT_EQ(drain(fromStdVector), descending);
+
+    // Appending more than the heap holds rebuilds it, appending fewer sifts each new element
+    stlcontainer::PriorityQueue<int> queue;
+    queue.push(4);
+    queue.push_range(values.begin(), values.end());
+    queue.push_range(values.begin(), values.begin() + 2);
+    ASSERT_EQ(drain(queue), std::vector<int>({9, 8, 7, 6, 5, 5, 4, 4, 3, 2, 1, 1, 0}));
+}
+
+TEST(PRIORITY_QUEUE, MOVE_ONLY_TRY_POP)
+{
+    auto compare = [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) { return *lhs < *rhs; };
+    stlcontainer::PriorityQueue<std::unique_ptr<int>, decltype(compare)> queue(compare);
+    queue.push(std::unique_ptr<int>(new int(2)));
+    queue.emplace(new int(5));
+    queue.push(std::unique_ptr<int>(new int(3)));
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(*value, 5);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(*value, 3);
+    ASSERT_EQ(queue.size(), 1);
+}
+
+TEST(PRIORITY_QUEUE, SWAP)
+{
+    stlcontainer::PriorityQueue<int> lhs;
+    stlcontainer::PriorityQueue<int> rhs;
+    lhs.push(1);
+    rhs.push(2);
+    rhs.push(3);
+    swap(lhs, rhs);
+    ASSERT_EQ(lhs.size(), 2);
+    ASSERT_EQ(lhs.top(), 3);
+    ASSERT_EQ(rhs.top(), 1);
+}
+
+TEST(INDEXED_PRIORITY_QUEUE, HANDLES)
+{
+    stlcontainer::IndexedPriorityQueue<int, std::greater<int>> queue;
+    auto five = queue.push(5);
+    auto two = queue.push(2);
+    auto eight = queue.push(8);
+
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queue.top(), 2);
+    ASSERT_EQ(queue.top_handle(), two);
+    ASSERT_EQ(queue.value(eight), 8);
+    ASSERT_TRUE(queue.contains(five));
+
+    queue.pop();
+    ASSERT_FALSE(queue.contains(two));
+    ASSERT_EQ(queue.top_handle(), five);
+
+    // Freed handles are handed out again
+    auto again = queue.push(1);
+    ASSERT_EQ(again, two);
+    ASSERT_EQ(queue.top(), 1);
+    ASSERT_FALSE(queue.contains(100));
+}
+
+TEST(INDEXED_PRIORITY_QUEUE, DECREASE_KEY_UPDATE_ERASE)
+{
+    stlcontainer::IndexedPriorityQueue<int, std::greater<int>> queue;
+    std::vector<size_t> handles;
+    for (int value = 10; value < 20; ++value)
+    {
+        handles.push_back(queue.push(value));
+    }
+
+    queue.promote(handles[7], 3);
+    ASSERT_EQ(queue.top(), 3);
+    ASSERT_EQ(queue.top_handle(), handles[7]);
+    ASSERT_THROW(queue.promote(handles[7], 4), std::invalid_argument);
+    ASSERT_EQ(queue.value(handles[7]), 3);
+
+    queue.update(handles[7], 50);
+    ASSERT_EQ(queue.top(), 10);
+    queue.update(handles[9], 0);
+    ASSERT_EQ(queue.top_handle(), handles[9]);
+
+    queue.erase(handles[9]);
+    queue.erase(handles[4]);
+    ASSERT_FALSE(queue.contains(handles[4]));
+    ASSERT_EQ(drain(queue), std::vector<int>({10, 11, 12, 13, 15, 16, 18, 50}));
+}
+
+TEST(INDEXED_PRIORITY_QUEUE, RANDOM_OPERATIONS)
+{
+    // Against a multiset of (value, handle) pairs
+    std::mt19937 random(3);
+    stlcontainer::IndexedPriorityQueue<int> queue;
+    std::set<std::pair<int, size_t>> reference;
+    std::map<size_t, int> live;
+
+    for (int round = 0; round < 20000; ++round)
+    {
+        auto operation = random() % 5;
+        if (operation < 2 || live.empty())
+        {
+            int value = static_cast<int>(random() % 500);
+            auto handle = queue.push(value);
+            ASSERT_EQ(live.count(handle), 0);
+            live[handle] = value;
+            reference.insert({value, handle});
+        }
+        else if (operation == 4)
+        {
+            ASSERT_EQ(queue.top(), reference.rbegin()->first);
+            reference.erase({queue.top(), queue.top_handle()});
+            live.erase(queue.top_handle());
+            queue.pop();
+        }
+        else
+        {
+            auto pick = live.begin();
+            std::advance(pick, random() % live.size());
+            auto handle = pick->first;
+            reference.erase({pick->second, handle});
+            if (operation == 2)
+            {
+                int value = static_cast<int>(random() % 500);
+                queue.update(handle, value);
+                pick->second = value;
+                reference.insert({value, handle});
+            }
+            else
+            {
+                queue.erase(handle);
+                live.erase(pick);
+            }
+        }
+        ASSERT_EQ(queue.size(), reference.size());
+        if (!queue.empty())
+        {
+            ASSERT_EQ(queue.top(), reference.rbegin()->first);
+            ASSERT_EQ(queue.value(queue.top_handle()), queue.top());
+        }
+    }
+}
+
+TEST(INDEXED_PRIORITY_QUEUE, BULK_CONSTRUCTION)
+{
+    std::vector<int> values = {5, 1, 9, 3, 7};
+    stlcontainer::IndexedPriorityQueue<int> queue(values.begin(), values.end());
+    for (size_t handle = 0; handle < values.size(); ++handle)
+    {
+        ASSERT_EQ(queue.value(handle), values[handle]);
+    }
+    ASSERT_EQ(queue.top_handle(), 2);
+    queue.promote(1, 10);
+    ASSERT_EQ(drain(queue), std::vector<int>({10, 9, 7, 5, 3}));
+}
+
+TEST(INDEXED_PRIORITY_QUEUE, SHORTEST_PATHS)
+{
+    // Dijkstra with one entry per vertex, relaxed in place with promote
+    const int INF = 1 << 30;
+    std::vector<std::vector<std::pair<int, int>>> edges = {
+        {{1, 4}, {2, 1}},
+        {{3, 1}},
+        {{1, 2}, {3, 5}},
+        {{4, 3}},
+        {},
+    };
+    std::vector<int> distance(edges.size(), INF);
+    distance[0] = 0;
+
+    stlcontainer::IndexedPriorityQueue<int, std::greater<int>> queue(distance.begin(), distance.end());
+    while (!queue.empty())
+    {
+        auto vertex = queue.top_handle();
+        queue.pop();
+        for (auto& edge : edges[vertex])
+        {
+            auto candidate = distance[vertex] + edge.second;
+            if (queue.contains(edge.first) && candidate < distance[edge.first])
+            {
+                distance[edge.first] = candidate;
+                queue.promote(edge.first, candidate);
+            }
+        }
+    }
+    ASSERT_EQ(distance, std::vector<int>({0, 3, 1, 4, 7}));
+}
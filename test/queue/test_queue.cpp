@@ -1,10 +1,49 @@
 #include <deque>
+#include <iterator>
 #include <list>
+#include <memory>
 #include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include "queue/Queue.h"
 
+namespace
+{
+// Only the operations Queue requires, so batched calls have to fall back to one element at a time
+template<typename T>
+class MinimalContainer
+{
+public:
+    using value_type =      T;
+    using size_type =       size_t;
+    using reference =       T&;
+    using const_reference = const T&;
+
+    T& front() { return _elements.front(); }
+    T& back() { return _elements.back(); }
+    bool empty() const { return _elements.empty(); }
+    size_t size() const { return _elements.size(); }
+    void push_back(const T& value) { _elements.push_back(value); ++pushes; }
+    void pop_front() { _elements.pop_front(); ++pops; }
+
+    size_t pushes = 0;
+    size_t pops = 0;
+
+private:
+    std::deque<T> _elements;
+};
+
+// Exposes the underlying container to check which path a batched call took
+template<typename T, typename Container>
+struct InspectableQueue : stlcontainer::Queue<T, Container>
+{
+    Container& container() { return this->_container; }
+};
+}
+
 TEST(STACK, EMPTY_CREATION_DEFAULT_CONSTRUCTOR)
 {
     stlcontainer::Queue<int> queue;
@@ -243,4 +282,173 @@ TEST(STACK, CONTAINER_VARIATIONS)
     ASSERT_EQ(queueDeque.size(), queueDequeCompare.size());   
     ASSERT_EQ(queueDeque.front(), queueDequeCompare.front());
     ASSERT_EQ(queueDeque.back(), queueDequeCompare.back());
-}
\ No newline at end of file
+}
+TEST(QUEUE, PUSH_RANGE)
+{
+    std::vector<int> values = {3, 1, 4, 1, 5};
+    stlcontainer::Queue<int> queue;
+    queue.push(9);
+    queue.push_range(values.begin(), values.end());
+    ASSERT_EQ(queue.size(), 6);
+    ASSERT_EQ(queue.front(), 9);
+    ASSERT_EQ(queue.back(), 5);
+
+    stlcontainer::Queue<int, std::list<int>> queueList;
+    queueList.push_range(values.begin(), values.end());
+    ASSERT_EQ(queueList.size(), 5);
+    ASSERT_EQ(queueList.front(), 3);
+
+    // Empty range is a no-op
+    queue.push_range(values.end(), values.end());
+    ASSERT_EQ(queue.size(), 6);
+}
+
+TEST(QUEUE, TRY_POP)
+{
+    stlcontainer::Queue<std::unique_ptr<int>> queue;
+    std::unique_ptr<int> value;
+    ASSERT_FALSE(queue.try_pop(value));
+
+    queue.push(std::unique_ptr<int>(new int(1)));
+    queue.push(std::unique_ptr<int>(new int(2)));
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(*value, 1);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(*value, 2);
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(*value, 2);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(QUEUE, POP_INTO)
+{
+    stlcontainer::Queue<int> queue({0, 1, 2, 3, 4, 5, 6});
+    std::vector<int> output;
+
+    ASSERT_EQ(queue.pop_into(std::back_inserter(output), 3), 3);
+    ASSERT_EQ(output, std::vector<int>({0, 1, 2}));
+    ASSERT_EQ(queue.front(), 3);
+
+    // Stops when the queue runs dry
+    ASSERT_EQ(queue.pop_into(std::back_inserter(output), 100), 4);
+    ASSERT_EQ(output, std::vector<int>({0, 1, 2, 3, 4, 5, 6}));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.pop_into(std::back_inserter(output), 5), 0);
+
+    stlcontainer::Queue<int, std::list<int>> queueList({7, 8, 9});
+    int array[2] = {};
+    ASSERT_EQ(queueList.pop_into(array, 2), 2);
+    ASSERT_EQ(array[0], 7);
+    ASSERT_EQ(array[1], 8);
+    ASSERT_EQ(queueList.front(), 9);
+}
+
+TEST(QUEUE, BATCH_MINIMAL_CONTAINER)
+{
+    // Containers without range insert or range erase get the element-wise path
+    std::vector<int> values = {1, 2, 3, 4};
+    InspectableQueue<int, MinimalContainer<int>> queue;
+    queue.push_range(values.begin(), values.end());
+    ASSERT_EQ(queue.container().pushes, 4);
+    ASSERT_EQ(queue.size(), 4);
+
+    std::vector<int> output;
+    ASSERT_EQ(queue.pop_into(std::back_inserter(output), 3), 3);
+    ASSERT_EQ(queue.container().pops, 3);
+    ASSERT_EQ(output, std::vector<int>({1, 2, 3}));
+
+    int value = 0;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 4);
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(QUEUE, ASSIGN_FROM_QUEUE)
+{
+    stlcontainer::Queue<int> queue(std::deque<int>{1, 2, 3});
+    stlcontainer::Queue<int> queueAssign(std::deque<int>{9});
+
+    queueAssign = queue;
+    ASSERT_TRUE(queueAssign == queue);
+    queueAssign.pop();
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queueAssign.front(), 2);
+
+    stlcontainer::Queue<int> queueMoveAssign;
+    queueMoveAssign = std::move(queue);
+    ASSERT_EQ(queueMoveAssign.size(), 3);
+    ASSERT_EQ(queueMoveAssign.front(), 1);
+    ASSERT_EQ(queueMoveAssign.back(), 3);
+
+    // Self-assignment keeps the contents
+    auto& self = queueMoveAssign;
+    queueMoveAssign = self;
+    ASSERT_EQ(queueMoveAssign.size(), 3);
+}
+
+TEST(QUEUE, ASSIGN_FROM_CONTAINER)
+{
+    stlcontainer::Queue<int> queue(std::deque<int>{7, 8});
+    const std::deque<int> batch = {1, 2, 3};
+
+    queue = batch;
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(batch.size(), 3);
+    ASSERT_EQ(queue.front(), 1);
+
+    std::deque<int> moved = {4, 5};
+    queue = std::move(moved);
+    ASSERT_EQ(queue.size(), 2);
+    ASSERT_EQ(queue.front(), 4);
+    ASSERT_EQ(queue.back(), 5);
+}
+
+TEST(QUEUE, ASSIGN_AND_TAKE_WITHOUT_COPY)
+{
+    // The storage handed in is the storage handed back: no element was copied either way
+    std::vector<std::unique_ptr<int>> batch;
+    for (int index = 0; index < 1000; ++index)
+    {
+        batch.emplace_back(new int(index));
+    }
+    auto storage = batch.data();
+
+    stlcontainer::Queue<std::unique_ptr<int>, std::vector<std::unique_ptr<int>>> queue;
+    queue = std::move(batch);
+    ASSERT_EQ(queue.size(), 1000);
+    ASSERT_EQ(*queue.front(), 0);
+
+    auto taken = queue.take_container();
+    ASSERT_EQ(taken.data(), storage);
+    ASSERT_EQ(taken.size(), 1000);
+    ASSERT_TRUE(queue.empty());
+
+    // The queue is usable after its container was taken
+    queue.push(std::unique_ptr<int>(new int(5)));
+    ASSERT_EQ(*queue.back(), 5);
+}
+
+TEST(QUEUE, TAKE_CONTAINER_DEQUE)
+{
+    stlcontainer::Queue<int> queue;
+    for (int index = 0; index < 5; ++index)
+    {
+        queue.push(index);
+    }
+    auto taken = queue.take_container();
+    ASSERT_EQ(taken, std::deque<int>({0, 1, 2, 3, 4}));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_TRUE(queue.take_container().empty());
+}
+
+TEST(QUEUE, NOEXCEPT_ASSIGNMENT)
+{
+    using VectorQueue = stlcontainer::Queue<int, std::vector<int>>;
+    static_assert(std::is_nothrow_move_assignable<VectorQueue>::value, "moving a queue must not throw");
+    static_assert(noexcept(std::declval<VectorQueue&>() = std::declval<std::vector<int>&&>()),
+        "moving a container in must not throw");
+    static_assert(noexcept(std::declval<VectorQueue&>().take_container()), "taking the container must not throw");
+    static_assert(std::is_nothrow_move_constructible<VectorQueue>::value, "moving a queue must not throw");
+    static_assert(std::is_nothrow_move_assignable<stlcontainer::Queue<int>>::value,
+        "std::deque move assignment does not throw");
+}
@@ -0,0 +1,238 @@
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/Queue.h"
+#include "queue/RingBuffer.h"
+#include "../Counted.h"
+
+namespace
+{
+// Copy may throw and there is no move, so growth has to copy; copies fail once the budget runs out
+struct ThrowingCopy
+{
+    static int budget;
+    int value;
+
+    ThrowingCopy(int val) : value(val) {}
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+    {
+        if (budget-- == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+    }
+};
+int ThrowingCopy::budget = 0;
+
+template<typename T>
+std::vector<T> contents(const stlcontainer::RingBuffer<T>& buffer)
+{
+    return std::vector<T>(buffer.begin(), buffer.end());
+}
+}
+
+TEST(RING_BUFFER, EMPTY_CREATION)
+{
+    stlcontainer::RingBuffer<int> buffer;
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.size(), 0);
+    ASSERT_EQ(buffer.capacity(), 0);
+    ASSERT_TRUE(buffer.begin() == buffer.end());
+}
+
+TEST(RING_BUFFER, PUSH_POP_FIFO)
+{
+    stlcontainer::RingBuffer<int> buffer = {1, 2, 3};
+    ASSERT_EQ(buffer.size(), 3);
+    ASSERT_EQ(buffer.front(), 1);
+    ASSERT_EQ(buffer.back(), 3);
+
+    buffer.push_back(4);
+    buffer.pop_front();
+    ASSERT_EQ(contents(buffer), std::vector<int>({2, 3, 4}));
+    ASSERT_EQ(buffer[1], 3);
+
+    buffer.pop_back();
+    ASSERT_EQ(buffer.back(), 3);
+}
+
+TEST(RING_BUFFER, WRAP_AROUND)
+{
+    // A steady producer/consumer pattern never grows past the first allocation
+    stlcontainer::RingBuffer<int> buffer;
+    std::deque<int> compare;
+    for (int index = 0; index < 1000; ++index)
+    {
+        buffer.push_back(index);
+        compare.push_back(index);
+        if (buffer.size() > 5)
+        {
+            buffer.pop_front();
+            compare.pop_front();
+        }
+        ASSERT_EQ(buffer.front(), compare.front());
+        ASSERT_EQ(buffer.back(), compare.back());
+    }
+    ASSERT_EQ(buffer.capacity(), stlcontainer::RingBuffer<int>::MIN_CAPACITY);
+    ASSERT_EQ(contents(buffer), std::vector<int>(compare.begin(), compare.end()));
+}
+
+TEST(RING_BUFFER, GROW_UNWRAPS)
+{
+    stlcontainer::RingBuffer<int> buffer;
+    for (int index = 0; index < 8; ++index)
+    {
+        buffer.push_back(index);
+    }
+    // Move the head into the middle so the contents wrap past the last slot
+    for (int index = 0; index < 5; ++index)
+    {
+        buffer.pop_front();
+        buffer.push_back(8 + index);
+    }
+    ASSERT_EQ(buffer.capacity(), 8);
+    ASSERT_GT(&buffer.front(), &buffer.back());
+
+    buffer.push_back(13);
+    ASSERT_EQ(buffer.capacity(), 16);
+    ASSERT_EQ(contents(buffer), std::vector<int>({5, 6, 7, 8, 9, 10, 11, 12, 13}));
+    ASSERT_EQ(&buffer.back() - &buffer.front(), 8);
+}
+
+TEST(RING_BUFFER, RESERVE)
+{
+    stlcontainer::RingBuffer<int> buffer = {1, 2};
+    buffer.reserve(100);
+    ASSERT_EQ(buffer.capacity(), 128);
+    ASSERT_EQ(contents(buffer), std::vector<int>({1, 2}));
+
+    buffer.reserve(10);
+    ASSERT_EQ(buffer.capacity(), 128);
+}
+
+TEST(RING_BUFFER, PUSH_OWN_ELEMENT_WHILE_GROWING)
+{
+    stlcontainer::RingBuffer<std::string> buffer;
+    for (int index = 0; index < 8; ++index)
+    {
+        buffer.push_back(std::string(20, static_cast<char>('a' + index)));
+    }
+    buffer.push_back(buffer.front());
+    ASSERT_EQ(buffer.size(), 9);
+    ASSERT_EQ(buffer.back(), std::string(20, 'a'));
+    ASSERT_EQ(buffer.front(), std::string(20, 'a'));
+}
+
+TEST(RING_BUFFER, GROW_THROWS)
+{
+    stlcontainer::RingBuffer<ThrowingCopy> buffer;
+    ThrowingCopy::budget = 100;
+    for (int index = 0; index < 8; ++index)
+    {
+        buffer.push_back(ThrowingCopy(index));
+    }
+
+    // The new element is built, then the fourth relocated copy throws
+    ThrowingCopy::budget = 4;
+    ASSERT_THROW(buffer.push_back(ThrowingCopy(8)), std::runtime_error);
+    ASSERT_EQ(buffer.size(), 8);
+    ASSERT_EQ(buffer.capacity(), 8);
+    for (int index = 0; index < 8; ++index)
+    {
+        ASSERT_EQ(buffer[index].value, index);
+    }
+}
+
+TEST(RING_BUFFER, MOVE_ONLY)
+{
+    stlcontainer::RingBuffer<std::unique_ptr<int>> buffer;
+    for (int index = 0; index < 20; ++index)
+    {
+        buffer.emplace_back(new int(index));
+    }
+    ASSERT_EQ(*buffer.front(), 0);
+    ASSERT_EQ(*buffer.back(), 19);
+}
+
+TEST(RING_BUFFER, COPY_MOVE_DESTROY)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::RingBuffer<Counted> buffer;
+        for (int index = 0; index < 12; ++index)
+        {
+            buffer.emplace_back(index);
+            if (index % 3 == 0)
+            {
+                buffer.pop_front();
+            }
+        }
+        ASSERT_EQ(Counted::live, 8);
+
+        stlcontainer::RingBuffer<Counted> copy(buffer);
+        ASSERT_EQ(Counted::live, 16);
+        ASSERT_EQ(copy.front().value, 4);
+
+        stlcontainer::RingBuffer<Counted> moved(std::move(copy));
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(Counted::live, 16);
+
+        moved = buffer;
+        ASSERT_EQ(Counted::live, 16);
+        buffer = std::move(moved);
+        ASSERT_EQ(Counted::live, 8);
+        buffer.clear();
+        ASSERT_EQ(Counted::live, 0);
+        buffer.emplace_back(1);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(RING_BUFFER, RELATIONAL_OPERATORS)
+{
+    stlcontainer::RingBuffer<int> lhs = {1, 2, 3};
+    stlcontainer::RingBuffer<int> rhs;
+    // Same contents at a different head position
+    rhs.push_back(0);
+    rhs.push_back(1);
+    rhs.pop_front();
+    rhs.push_back(2);
+    rhs.push_back(3);
+
+    ASSERT_TRUE(lhs == rhs);
+    ASSERT_FALSE(lhs != rhs);
+    rhs.push_back(0);
+    ASSERT_TRUE(lhs < rhs);
+    ASSERT_TRUE(rhs > lhs);
+    ASSERT_TRUE(lhs <= rhs);
+    ASSERT_TRUE(rhs >= lhs);
+}
+
+TEST(RING_BUFFER, QUEUE_CONTAINER)
+{
+    stlcontainer::Queue<int, stlcontainer::RingBuffer<int>> queue({1, 2, 3});
+    queue.push(4);
+    ASSERT_EQ(queue.size(), 4);
+    ASSERT_EQ(queue.front(), 1);
+    ASSERT_EQ(queue.back(), 4);
+    queue.pop();
+    ASSERT_EQ(queue.front(), 2);
+
+    std::vector<int> values = {5, 6, 7};
+    queue.push_range(values.begin(), values.end());
+    std::vector<int> output;
+    ASSERT_EQ(queue.pop_into(std::back_inserter(output), 4), 4);
+    ASSERT_EQ(output, std::vector<int>({2, 3, 4, 5}));
+
+    int value = 0;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 6);
+
+    stlcontainer::Queue<int, stlcontainer::RingBuffer<int>> other({7});
+    ASSERT_TRUE(queue == other);
+}
@@ -0,0 +1,153 @@
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "queue/SPSCQueue.h"
+#include "../Counted.h"
+
+TEST(SPSC_QUEUE, EMPTY_CREATION)
+{
+    stlcontainer::SPSCQueue<int> queue(8);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0);
+    ASSERT_EQ(queue.capacity(), 8);
+    ASSERT_EQ(queue.front(), nullptr);
+
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(SPSC_QUEUE, CAPACITY_POWER_OF_TWO)
+{
+    ASSERT_EQ(stlcontainer::SPSCQueue<int>(0).capacity(), 1);
+    ASSERT_EQ(stlcontainer::SPSCQueue<int>(1).capacity(), 1);
+    ASSERT_EQ(stlcontainer::SPSCQueue<int>(5).capacity(), 8);
+    ASSERT_EQ(stlcontainer::SPSCQueue<int>(1024).capacity(), 1024);
+    ASSERT_EQ(stlcontainer::SPSCQueue<int>(1025).capacity(), 2048);
+}
+
+TEST(SPSC_QUEUE, PUSH_POP_FULL)
+{
+    stlcontainer::SPSCQueue<int> queue(4);
+    for (int index = 0; index < 4; ++index)
+    {
+        ASSERT_TRUE(queue.try_push(index));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+    ASSERT_EQ(queue.size(), 4);
+
+    int value = -1;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(queue.try_push(4));
+    ASSERT_FALSE(queue.try_push(5));
+
+    for (int expected = 1; expected <= 4; ++expected)
+    {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, expected);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(SPSC_QUEUE, WRAP_AROUND)
+{
+    // Indices run far past the capacity, order is kept throughout
+    stlcontainer::SPSCQueue<int> queue(8);
+    int nextPush = 0;
+    int nextPop = 0;
+    for (int round = 0; round < 1000; ++round)
+    {
+        for (int index = 0; index < round % 8 + 1; ++index)
+        {
+            ASSERT_TRUE(queue.try_push(nextPush++));
+        }
+        int value = 0;
+        while (queue.try_pop(value))
+        {
+            ASSERT_EQ(value, nextPop++);
+        }
+    }
+    ASSERT_EQ(nextPop, nextPush);
+}
+
+TEST(SPSC_QUEUE, FRONT_POP_IN_PLACE)
+{
+    stlcontainer::SPSCQueue<std::string> queue(2);
+    ASSERT_TRUE(queue.try_emplace(3, 'a'));
+    ASSERT_TRUE(queue.try_push(std::string("b")));
+
+    auto front = queue.front();
+    ASSERT_NE(front, nullptr);
+    ASSERT_EQ(*front, "aaa");
+    queue.pop();
+    ASSERT_EQ(*queue.front(), "b");
+    queue.pop();
+    ASSERT_EQ(queue.front(), nullptr);
+}
+
+TEST(SPSC_QUEUE, MOVE_ONLY)
+{
+    stlcontainer::SPSCQueue<std::unique_ptr<int>> queue(2);
+    ASSERT_TRUE(queue.try_push(std::unique_ptr<int>(new int(7))));
+
+    std::unique_ptr<int> value;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(*value, 7);
+}
+
+TEST(SPSC_QUEUE, DESTRUCTOR_FREES_VALUES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::SPSCQueue<Counted> queue(4);
+        for (int index = 0; index < 3; ++index)
+        {
+            queue.try_emplace(index);
+        }
+        Counted value;
+        queue.try_pop(value);
+        ASSERT_EQ(Counted::live, 3);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(SPSC_QUEUE, PRODUCER_CONSUMER)
+{
+    // A small ring forces both sides through the full and empty paths many times
+    const int COUNT = 200000;
+    stlcontainer::SPSCQueue<int> queue(16);
+
+    std::thread producer([&queue] {
+        for (int index = 0; index < COUNT; ++index)
+        {
+            while (!queue.try_push(index))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long sum = 0;
+    int expected = 0;
+    while (expected < COUNT)
+    {
+        int value = 0;
+        if (queue.try_pop(value))
+        {
+            ASSERT_EQ(value, expected);
+            sum += value;
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    ASSERT_EQ(sum, static_cast<long>(COUNT) * (COUNT - 1) / 2);
+    ASSERT_TRUE(queue.empty());
+}
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/ThreadPool.h"
+
+namespace
+{
+long fibonacci(stlcontainer::ThreadPool& pool, int number)
+{
+    if (number < 12)
+    {
+        return number < 2 ? number : fibonacci(pool, number - 1) + fibonacci(pool, number - 2);
+    }
+    long left = 0;
+    stlcontainer::TaskGroup group;
+    pool.spawn(group, [&] { left = fibonacci(pool, number - 1); });
+    long right = fibonacci(pool, number - 2);
+    pool.wait(group);
+    return left + right;
+}
+
+long parallel_sum(stlcontainer::ThreadPool& pool, const int* first, const int* last)
+{
+    if (last - first <= 1024)
+    {
+        return std::accumulate(first, last, 0L);
+    }
+    auto middle = first + (last - first) / 2;
+    long left = 0;
+    stlcontainer::TaskGroup group;
+    pool.spawn(group, [&] { left = parallel_sum(pool, first, middle); });
+    long right = parallel_sum(pool, middle, last);
+    pool.wait(group);
+    return left + right;
+}
+
+void parallel_quicksort(stlcontainer::ThreadPool& pool, int* first, int* last)
+{
+    if (last - first <= 512)
+    {
+        std::sort(first, last);
+        return;
+    }
+    auto pivot = first[(last - first) / 2];
+    auto middle1 = std::partition(first, last, [pivot](int value) { return value < pivot; });
+    auto middle2 = std::partition(middle1, last, [pivot](int value) { return !(pivot < value); });
+    stlcontainer::TaskGroup group;
+    pool.spawn(group, [&pool, first, middle1] { parallel_quicksort(pool, first, middle1); });
+    parallel_quicksort(pool, middle2, last);
+    pool.wait(group);
+}
+}
+
+TEST(THREAD_POOL, CREATION)
+{
+    stlcontainer::ThreadPool pool(3);
+    ASSERT_EQ(pool.size(), 3);
+    ASSERT_EQ(stlcontainer::ThreadPool(0).size(), 1);
+
+    // Waiting on a group nothing was spawned into returns at once
+    stlcontainer::TaskGroup group;
+    ASSERT_TRUE(group.done());
+    pool.wait(group);
+}
+
+TEST(THREAD_POOL, SPAWN_FROM_OUTSIDE)
+{
+    stlcontainer::ThreadPool pool(4);
+    std::atomic<int> counter{0};
+    stlcontainer::TaskGroup group;
+    for (int index = 0; index < 10000; ++index)
+    {
+        pool.spawn(group, [&counter] { counter.fetch_add(1); });
+    }
+    pool.wait(group);
+    ASSERT_TRUE(group.done());
+    ASSERT_EQ(counter.load(), 10000);
+
+    // The group can be used again
+    pool.spawn(group, [&counter] { counter.fetch_add(1); });
+    pool.wait(group);
+    ASSERT_EQ(counter.load(), 10001);
+}
+
+TEST(THREAD_POOL, NESTED_FORK_JOIN)
+{
+    // Every level waits inside a task, which only works because waiting threads run queued tasks
+    for (size_t threads : {1, 2, 4})
+    {
+        stlcontainer::ThreadPool pool(threads);
+        ASSERT_EQ(fibonacci(pool, 24), 46368);
+    }
+}
+
+TEST(THREAD_POOL, PARALLEL_SUM)
+{
+    std::vector<int> values(1 << 20);
+    std::iota(values.begin(), values.end(), 0);
+    stlcontainer::ThreadPool pool(4);
+
+    auto expected = std::accumulate(values.begin(), values.end(), 0L);
+    ASSERT_EQ(parallel_sum(pool, values.data(), values.data() + values.size()), expected);
+}
+
+TEST(THREAD_POOL, PARALLEL_QUICKSORT)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> distribution(0, 1000);
+    std::vector<int> values(200000);
+    for (auto& value : values)
+    {
+        value = distribution(random);
+    }
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    stlcontainer::ThreadPool pool(4);
+    parallel_quicksort(pool, values.data(), values.data() + values.size());
+    ASSERT_EQ(values, expected);
+}
+
+TEST(THREAD_POOL, EXCEPTION_REACHES_WAIT)
+{
+    stlcontainer::ThreadPool pool(2);
+    std::atomic<int> counter{0};
+    stlcontainer::TaskGroup group;
+    for (int index = 0; index < 100; ++index)
+    {
+        pool.spawn(group, [&counter, index] {
+            counter.fetch_add(1);
+            if (index == 42)
+            {
+                throw std::runtime_error("task failed");
+            }
+        });
+    }
+    ASSERT_THROW(pool.wait(group), std::runtime_error);
+
+    // The other tasks still ran, and the group is clean afterwards
+    ASSERT_EQ(counter.load(), 100);
+    pool.spawn(group, [&counter] { counter.fetch_add(1); });
+    pool.wait(group);
+    ASSERT_EQ(counter.load(), 101);
+}
+
+TEST(THREAD_POOL, SPAWN_FROM_MANY_THREADS)
+{
+    stlcontainer::ThreadPool pool(2);
+    std::atomic<int> counter{0};
+    std::vector<std::thread> spawners;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        spawners.emplace_back([&] {
+            stlcontainer::TaskGroup group;
+            for (int index = 0; index < 1000; ++index)
+            {
+                pool.spawn(group, [&counter] { counter.fetch_add(1); });
+            }
+            pool.wait(group);
+        });
+    }
+    for (auto& spawner : spawners)
+    {
+        spawner.join();
+    }
+    ASSERT_EQ(counter.load(), 4000);
+}
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "queue/WorkStealingDeque.h"
+
+TEST(WORK_STEALING_DEQUE, EMPTY_CREATION)
+{
+    stlcontainer::WorkStealingDeque<int> deque;
+    ASSERT_TRUE(deque.empty());
+    ASSERT_EQ(deque.size(), 0);
+    ASSERT_EQ(deque.capacity(), 64);
+
+    int value = 0;
+    ASSERT_FALSE(deque.try_pop(value));
+    ASSERT_FALSE(deque.try_steal(value));
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WORK_STEALING_DEQUE, CAPACITY_POWER_OF_TWO)
+{
+    ASSERT_EQ(stlcontainer::WorkStealingDeque<int>(0).capacity(), 2);
+    ASSERT_EQ(stlcontainer::WorkStealingDeque<int>(5).capacity(), 8);
+    ASSERT_EQ(stlcontainer::WorkStealingDeque<int>(1024).capacity(), 1024);
+}
+
+TEST(WORK_STEALING_DEQUE, POP_LIFO_STEAL_FIFO)
+{
+    stlcontainer::WorkStealingDeque<int> deque;
+    for (int index = 0; index < 6; ++index)
+    {
+        deque.push(index);
+    }
+    ASSERT_EQ(deque.size(), 6);
+
+    int value = -1;
+    ASSERT_TRUE(deque.try_pop(value));
+    ASSERT_EQ(value, 5);
+    ASSERT_TRUE(deque.try_steal(value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(deque.try_pop(value));
+    ASSERT_EQ(value, 4);
+    ASSERT_TRUE(deque.try_steal(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_EQ(deque.size(), 2);
+
+    // The last element goes through the owner's CAS path
+    ASSERT_TRUE(deque.try_pop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_TRUE(deque.try_pop(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_FALSE(deque.try_pop(value));
+    ASSERT_FALSE(deque.try_steal(value));
+
+    deque.push(7);
+    ASSERT_TRUE(deque.try_steal(value));
+    ASSERT_EQ(value, 7);
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WORK_STEALING_DEQUE, GROWTH_KEEPS_ORDER)
+{
+    // Steals move the live range off index zero, so growth has to copy a wrapped range
+    stlcontainer::WorkStealingDeque<int> deque(4);
+    int value = 0;
+    for (int index = 0; index < 3; ++index)
+    {
+        deque.push(index);
+    }
+    ASSERT_TRUE(deque.try_steal(value));
+    ASSERT_TRUE(deque.try_steal(value));
+    for (int index = 3; index < 100; ++index)
+    {
+        deque.push(index);
+    }
+    ASSERT_EQ(deque.capacity(), 128);
+    ASSERT_EQ(deque.size(), 98);
+
+    for (int expected = 2; expected < 50; ++expected)
+    {
+        ASSERT_TRUE(deque.try_steal(value));
+        ASSERT_EQ(value, expected);
+    }
+    for (int expected = 99; expected >= 50; --expected)
+    {
+        ASSERT_TRUE(deque.try_pop(value));
+        ASSERT_EQ(value, expected);
+    }
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WORK_STEALING_DEQUE, POINTER_ELEMENTS)
+{
+    int items[3] = {10, 20, 30};
+    stlcontainer::WorkStealingDeque<int*> deque;
+    for (auto& item : items)
+    {
+        deque.push(&item);
+    }
+
+    int* value = nullptr;
+    ASSERT_TRUE(deque.try_steal(value));
+    ASSERT_EQ(*value, 10);
+    ASSERT_TRUE(deque.try_pop(value));
+    ASSERT_EQ(*value, 30);
+}
+
+TEST(WORK_STEALING_DEQUE, OWNER_AND_THIEVES)
+{
+    // A small initial ring makes the owner grow it while thieves read from the old one. Every element has
+    // to be taken exactly once, by the owner or by one of the thieves.
+    const int COUNT = 200000;
+    const int THIEVES = 3;
+    stlcontainer::WorkStealingDeque<int> deque(2);
+    std::vector<std::atomic<int>> taken(COUNT);
+    for (auto& each : taken)
+    {
+        each.store(0);
+    }
+    std::atomic<bool> ownerDone{false};
+    std::atomic<int> stolen{0};
+
+    std::vector<std::thread> thieves;
+    for (int thief = 0; thief < THIEVES; ++thief)
+    {
+        thieves.emplace_back([&] {
+            int value = 0;
+            while (!ownerDone.load() || !deque.empty())
+            {
+                if (deque.try_steal(value))
+                {
+                    taken[value].fetch_add(1);
+                    stolen.fetch_add(1);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    int value = 0;
+    for (int index = 0; index < COUNT; ++index)
+    {
+        deque.push(index);
+        // Pop one of every three pushed, leaving the rest for the thieves
+        if (index % 3 == 0 && deque.try_pop(value))
+        {
+            taken[value].fetch_add(1);
+        }
+    }
+    while (deque.try_pop(value))
+    {
+        taken[value].fetch_add(1);
+    }
+    ownerDone.store(true);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    ASSERT_TRUE(std::all_of(taken.begin(), taken.end(), [](const std::atomic<int>& count) { return count.load() == 1; }));
+    ASSERT_LE(stolen.load(), COUNT);
+}
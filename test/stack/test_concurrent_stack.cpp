@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "stack/ConcurrentStack.h"
+#include "../Counted.h"
+
+namespace
+{
+// Producer id in the high bits, per-producer sequence in the low bits
+const int SEQUENCE_BITS = 20;
+
+int encode(int producer, int sequence)
+{
+    return (producer << SEQUENCE_BITS) | sequence;
+}
+
+// One completed operation of a concurrent history. invoked and responded come from one shared counter, so
+// a < b between them means a happened before b.
+struct Operation
+{
+    bool push;
+    int value;          // Pushed, or popped when found
+    bool found;         // Pops only: false when the stack was empty
+    uint64_t invoked;
+    uint64_t responded;
+};
+
+// Wing and Gong's search: true when some order of the operations that respects real time is a legal
+// sequential stack history. Only for histories of a dozen or so operations.
+bool linearizable(const std::vector<Operation>& history, std::vector<bool>& done, std::vector<int>& model,
+    size_t remaining)
+{
+    if (remaining == 0)
+    {
+        return true;
+    }
+    // Any pending operation that no other pending operation wholly precedes may take effect next
+    uint64_t first_response = UINT64_MAX;
+    for (size_t index = 0; index < history.size(); ++index)
+    {
+        if (!done[index])
+        {
+            first_response = std::min(first_response, history[index].responded);
+        }
+    }
+    for (size_t index = 0; index < history.size(); ++index)
+    {
+        const auto& operation = history[index];
+        if (done[index] || operation.invoked > first_response)
+        {
+            continue;
+        }
+
+        done[index] = true;
+        if (operation.push)
+        {
+            model.push_back(operation.value);
+            if (linearizable(history, done, model, remaining - 1))
+            {
+                return true;
+            }
+            model.pop_back();
+        }
+        else if (!operation.found && model.empty())
+        {
+            if (linearizable(history, done, model, remaining - 1))
+            {
+                return true;
+            }
+        }
+        else if (operation.found && !model.empty() && model.back() == operation.value)
+        {
+            model.pop_back();
+            if (linearizable(history, done, model, remaining - 1))
+            {
+                return true;
+            }
+            model.push_back(operation.value);
+        }
+        done[index] = false;
+    }
+    return false;
+}
+
+// Runs rounds of short histories, THREADS threads doing OPERATIONS mixed pushes and pops each, and checks
+// every history against the sequential specification
+template<typename Stack>
+void check_linearizable_histories()
+{
+    const int THREADS = 3;
+    const int OPERATIONS = 4;
+    const int ROUNDS = 300;
+
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        Stack stack(THREADS * OPERATIONS);
+        std::atomic<uint64_t> clock(0);
+        std::atomic<int> ready(0);
+        std::vector<std::vector<Operation>> histories(THREADS);
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < THREADS; ++thread)
+        {
+            threads.emplace_back([&, thread] {
+                ++ready;
+                while (ready.load() != THREADS)
+                {
+                    std::this_thread::yield();
+                }
+                for (int index = 0; index < OPERATIONS; ++index)
+                {
+                    Operation operation{((round + thread + index) % 3) != 0, encode(thread, index), true, 0, 0};
+                    operation.invoked = clock.fetch_add(1);
+                    if (operation.push)
+                    {
+                        stack.try_push(operation.value);
+                    }
+                    else
+                    {
+                        operation.found = stack.try_pop(operation.value);
+                    }
+                    operation.responded = clock.fetch_add(1);
+                    histories[thread].push_back(operation);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<Operation> history;
+        for (const auto& operations : histories)
+        {
+            history.insert(history.end(), operations.begin(), operations.end());
+        }
+        std::vector<bool> done(history.size(), false);
+        std::vector<int> model;
+        ASSERT_TRUE(linearizable(history, done, model, history.size())) << "round " << round;
+    }
+}
+
+// Producers push distinct values into a small stack while consumers pop them. Every value must come out
+// exactly once.
+template<typename Stack>
+void check_no_loss_or_duplication()
+{
+    const int PRODUCERS = 4;
+    const int CONSUMERS = 4;
+    const int PER_PRODUCER = 20000;
+
+    Stack stack(64);
+    std::vector<std::atomic<int>> seen(PRODUCERS * PER_PRODUCER);
+    for (auto& count : seen)
+    {
+        count.store(0);
+    }
+    std::atomic<int> popped(0);
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < PRODUCERS; ++producer)
+    {
+        threads.emplace_back([&, producer] {
+            for (int sequence = 0; sequence < PER_PRODUCER; ++sequence)
+            {
+                while (!stack.try_push(producer * PER_PRODUCER + sequence))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int consumer = 0; consumer < CONSUMERS; ++consumer)
+    {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (popped.load() < PRODUCERS * PER_PRODUCER)
+            {
+                if (stack.try_pop(value))
+                {
+                    ++seen[value];
+                    ++popped;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& count : seen)
+    {
+        ASSERT_EQ(count.load(), 1);
+    }
+    ASSERT_TRUE(stack.empty());
+}
+}
+
+TEST(CONCURRENT_STACK, EMPTY_CREATION)
+{
+    stlcontainer::ConcurrentStack<int> stack(8);
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(stack.capacity(), 8u);
+
+    int value = 0;
+    ASSERT_FALSE(stack.try_pop(value));
+
+    stlcontainer::ConcurrentStack<int> none(0);
+    ASSERT_FALSE(none.try_push(1));
+}
+
+TEST(CONCURRENT_STACK, LIFO_ORDER_AND_CAPACITY)
+{
+    stlcontainer::ConcurrentStack<int> stack(4);
+    for (int index = 0; index < 4; ++index)
+    {
+        ASSERT_TRUE(stack.try_push(index));
+    }
+    ASSERT_FALSE(stack.try_push(4));
+
+    int value = -1;
+    ASSERT_TRUE(stack.try_pop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_TRUE(stack.try_push(30));
+    for (int expected : {30, 2, 1, 0})
+    {
+        ASSERT_TRUE(stack.try_pop(value));
+        ASSERT_EQ(value, expected);
+    }
+    ASSERT_FALSE(stack.try_pop(value));
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(CONCURRENT_STACK, MOVE_ONLY_ELEMENTS_AND_LIFETIMES)
+{
+    stlcontainer::ConcurrentStack<std::unique_ptr<int>> pointers(2);
+    ASSERT_TRUE(pointers.try_emplace(new int(7)));
+    std::unique_ptr<int> popped;
+    ASSERT_TRUE(pointers.try_pop(popped));
+    ASSERT_EQ(*popped, 7);
+
+    Counted::live = 0;
+    {
+        stlcontainer::ConcurrentStack<Counted> stack(8);
+        for (int index = 0; index < 5; ++index)
+        {
+            stack.try_emplace(index);
+        }
+        ASSERT_EQ(Counted::live.load(), 5);
+        Counted value;
+        stack.try_pop(value);
+        ASSERT_EQ(value.value, 4);
+        ASSERT_EQ(Counted::live.load(), 5);
+    }
+    ASSERT_EQ(Counted::live.load(), 0);
+}
+
+TEST(CONCURRENT_STACK, CAPACITY_MUST_FIT_NODE_INDEX)
+{
+    ASSERT_THROW(stlcontainer::ConcurrentStack<char>(size_t(1) << 33), std::length_error);
+}
+
+TEST(CONCURRENT_STACK, PER_PRODUCER_ORDER_SINGLE_CONSUMER)
+{
+    // With one consumer draining only after every producer finished, each producer's values come out newest
+    // first
+    const int PRODUCERS = 4;
+    const int PER_PRODUCER = 1000;
+    stlcontainer::ConcurrentStack<int> stack(PRODUCERS * PER_PRODUCER);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCERS; ++producer)
+    {
+        producers.emplace_back([&, producer] {
+            for (int sequence = 0; sequence < PER_PRODUCER; ++sequence)
+            {
+                ASSERT_TRUE(stack.try_push(encode(producer, sequence)));
+            }
+        });
+    }
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+
+    std::vector<int> last(PRODUCERS, PER_PRODUCER);
+    int value = 0;
+    while (stack.try_pop(value))
+    {
+        auto producer = value >> SEQUENCE_BITS;
+        auto sequence = value & ((1 << SEQUENCE_BITS) - 1);
+        ASSERT_EQ(sequence, last[producer] - 1);
+        last[producer] = sequence;
+    }
+    ASSERT_EQ(last, std::vector<int>(PRODUCERS, 0));
+}
+
+TEST(CONCURRENT_STACK, NO_LOSS_OR_DUPLICATION)
+{
+    check_no_loss_or_duplication<stlcontainer::ConcurrentStack<int>>();
+    check_no_loss_or_duplication<stlcontainer::ConcurrentStack<int, 0>>();
+}
+
+TEST(CONCURRENT_STACK, HISTORIES_ARE_LINEARIZABLE)
+{
+    check_linearizable_histories<stlcontainer::ConcurrentStack<int>>();
+    check_linearizable_histories<stlcontainer::ConcurrentStack<int, 0>>();
+}
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "stack/PersistentStack.h"
+#include "../Counted.h"
+
+TEST(PERSISTENT_STACK, PUSH_AND_POP_LEAVE_ORIGINAL_UNCHANGED)
+{
+    stlcontainer::PersistentStack<int> empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.size(), 0u);
+
+    auto one = empty.push(1);
+    auto two = one.push(2);
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(one.size(), 1u);
+    ASSERT_EQ(one.top(), 1);
+    ASSERT_EQ(two.size(), 2u);
+    ASSERT_EQ(two.top(), 2);
+
+    auto popped = two.pop();
+    ASSERT_EQ(two.top(), 2);
+    ASSERT_TRUE(popped.shares_with(one));
+    ASSERT_TRUE(popped == one);
+}
+
+TEST(PERSISTENT_STACK, SNAPSHOTS_SHARE_STRUCTURE)
+{
+    auto base = stlcontainer::PersistentStack<std::string>().push("a").push("b");
+    auto snapshot = base;
+    ASSERT_TRUE(snapshot.shares_with(base));
+
+    // Two branches from one snapshot, each keeps its own top over the shared base
+    auto left = snapshot.push("left");
+    auto right = snapshot.emplace(3, 'r');
+    ASSERT_EQ(left.top(), "left");
+    ASSERT_EQ(right.top(), "rrr");
+    ASSERT_TRUE(left.pop().shares_with(right.pop()));
+    ASSERT_TRUE(left != right);
+
+    // Equal contents built separately compare equal too
+    auto rebuilt = stlcontainer::PersistentStack<std::string>().push("a").push("b").push("left");
+    ASSERT_TRUE(rebuilt == left);
+    ASSERT_FALSE(rebuilt.shares_with(left));
+}
+
+TEST(PERSISTENT_STACK, NODES_FREED_WHEN_LAST_OWNER_GOES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::PersistentStack<Counted> stack;
+        for (int index = 0; index < 10; ++index)
+        {
+            stack = stack.emplace(index);
+        }
+        ASSERT_EQ(Counted::live.load(), 10);
+
+        auto snapshot = stack.pop().pop();
+        stack = stlcontainer::PersistentStack<Counted>();
+        ASSERT_EQ(Counted::live.load(), 8);
+        ASSERT_EQ(snapshot.top().value, 7);
+
+        auto moved = std::move(snapshot);
+        ASSERT_TRUE(snapshot.empty());
+        swap(moved, snapshot);
+        ASSERT_EQ(snapshot.size(), 8u);
+    }
+    ASSERT_EQ(Counted::live.load(), 0);
+}
+
+TEST(PERSISTENT_STACK, LONG_CHAIN_RELEASES_WITHOUT_RECURSION)
+{
+    stlcontainer::PersistentStack<int> stack;
+    for (int index = 0; index < 1000000; ++index)
+    {
+        stack = stack.push(index);
+    }
+    ASSERT_EQ(stack.size(), 1000000u);
+    stack = stlcontainer::PersistentStack<int>();
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(PERSISTENT_STACK, SHARED_ACROSS_THREADS)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::PersistentStack<Counted> base;
+        for (int index = 0; index < 100; ++index)
+        {
+            base = base.emplace(index);
+        }
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < 4; ++thread)
+        {
+            threads.emplace_back([base, thread] {
+                auto local = base;
+                for (int round = 0; round < 1000; ++round)
+                {
+                    local = local.emplace(thread).pop().pop();
+                    if (local.empty())
+                    {
+                        local = base;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_EQ(Counted::live.load(), 100);
+    }
+    ASSERT_EQ(Counted::live.load(), 0);
+}
@@ -0,0 +1,203 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include "stack/SegmentedStack.h"
+#include "../Counted.h"
+
+namespace
+{
+// Construction from a negative value throws
+struct Picky
+{
+    int value;
+
+    explicit Picky(int val) : value(val)
+    {
+        if (val < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+    }
+};
+}
+
+TEST(SEGMENTED_STACK, PUSH_POP_ACROSS_SEGMENTS)
+{
+    stlcontainer::SegmentedStack<int, 4> stack;
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(stack.segment_count(), 0u);
+
+    for (int index = 0; index < 10; ++index)
+    {
+        stack.push(index);
+        ASSERT_EQ(stack.top(), index);
+    }
+    ASSERT_EQ(stack.size(), 10u);
+    ASSERT_EQ(stack.segment_count(), 3u);
+
+    for (int index = 9; index >= 0; --index)
+    {
+        ASSERT_EQ(stack.top(), index);
+        stack.pop();
+    }
+    ASSERT_TRUE(stack.empty());
+
+    // Segments stay for the next push until shrink_to_fit
+    ASSERT_EQ(stack.segment_count(), 3u);
+    stack.push(1);
+    ASSERT_EQ(stack.top(), 1);
+    stack.shrink_to_fit();
+    ASSERT_EQ(stack.segment_count(), 1u);
+    stack.pop();
+    stack.shrink_to_fit();
+    ASSERT_EQ(stack.segment_count(), 0u);
+    stack.push(2);
+    ASSERT_EQ(stack.top(), 2);
+}
+
+TEST(SEGMENTED_STACK, ROLLBACK_DROPS_SPECULATIVE_ELEMENTS)
+{
+    stlcontainer::SegmentedStack<int, 4> stack;
+    stack.push(1);
+    stack.push(2);
+    auto mark = stack.mark();
+    ASSERT_EQ(mark.size(), 2u);
+
+    for (int index = 0; index < 9; ++index)
+    {
+        stack.push(100 + index);
+    }
+    stack.rollback(mark);
+    ASSERT_EQ(stack.size(), 2u);
+    ASSERT_EQ(stack.top(), 2);
+
+    // The stack keeps working across the boundaries it rolled back over
+    for (int index = 0; index < 9; ++index)
+    {
+        stack.push(200 + index);
+    }
+    ASSERT_EQ(stack.top(), 208);
+    stack.rollback(mark);
+    stack.pop();
+    ASSERT_EQ(stack.top(), 1);
+
+    // Rolling back to a segment boundary and to the bottom
+    stlcontainer::SegmentedStack<int, 4> boundary;
+    for (int index = 0; index < 4; ++index)
+    {
+        boundary.push(index);
+    }
+    auto full = boundary.mark();
+    auto bottom = stlcontainer::SegmentedStack<int, 4>().mark();
+    boundary.push(4);
+    boundary.rollback(full);
+    ASSERT_EQ(boundary.top(), 3);
+    boundary.pop();
+    ASSERT_EQ(boundary.top(), 2);
+    boundary.rollback(bottom);
+    ASSERT_TRUE(boundary.empty());
+    boundary.push(7);
+    ASSERT_EQ(boundary.top(), 7);
+}
+
+TEST(SEGMENTED_STACK, NESTED_MARKS_AND_COMMIT)
+{
+    stlcontainer::SegmentedStack<std::string, 2> stack;
+    stack.push("base");
+    auto outer = stack.mark();
+    stack.push("a");
+    auto inner = stack.mark();
+    stack.push("b");
+    stack.push("c");
+    stack.commit(inner);
+    ASSERT_EQ(stack.size(), 4u);
+    ASSERT_EQ(stack.top(), "c");
+
+    // The outer mark still covers what the inner commit kept
+    stack.rollback(outer);
+    ASSERT_EQ(stack.size(), 1u);
+    ASSERT_EQ(stack.top(), "base");
+
+    // A mark the stack has been popped below is no longer valid
+    ASSERT_THROW(stack.rollback(inner), std::invalid_argument);
+    ASSERT_THROW(stack.commit(inner), std::invalid_argument);
+}
+
+TEST(SEGMENTED_STACK, ELEMENT_LIFETIMES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::SegmentedStack<Counted, 3> stack;
+        stack.emplace(1);
+        auto mark = stack.mark();
+        for (int index = 0; index < 10; ++index)
+        {
+            stack.emplace(index);
+        }
+        ASSERT_EQ(Counted::live, 11);
+        stack.rollback(mark);
+        ASSERT_EQ(Counted::live, 1);
+        ASSERT_EQ(stack.top().value, 1);
+        for (int index = 0; index < 5; ++index)
+        {
+            stack.push(stack.top());
+        }
+        ASSERT_EQ(Counted::live, 6);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(SEGMENTED_STACK, THROWING_CONSTRUCTOR_AT_SEGMENT_BOUNDARY)
+{
+    stlcontainer::SegmentedStack<Picky, 2> stack;
+    ASSERT_THROW(stack.emplace(-1), std::invalid_argument);
+    ASSERT_TRUE(stack.empty());
+
+    stack.emplace(1);
+    stack.emplace(2);
+    ASSERT_THROW(stack.emplace(-1), std::invalid_argument);
+    ASSERT_EQ(stack.size(), 2);
+    ASSERT_EQ(stack.top().value, 2);
+    stack.pop();
+    ASSERT_EQ(stack.top().value, 1);
+
+    stack.emplace(3);
+    stack.emplace(4);
+    ASSERT_EQ(stack.top().value, 4);
+    ASSERT_EQ(stack.segment_count(), 2);
+    stack.pop();
+    stack.pop();
+    stack.pop();
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(SEGMENTED_STACK, COPY_MOVE_COMPARE)
+{
+    stlcontainer::SegmentedStack<int, 2> stack;
+    for (int index = 0; index < 5; ++index)
+    {
+        stack.push(index);
+    }
+
+    auto copy = stack;
+    ASSERT_TRUE(copy == stack);
+    copy.pop();
+    ASSERT_TRUE(copy != stack);
+    ASSERT_TRUE(copy < stack);
+    copy.push(9);
+    ASSERT_TRUE(copy > stack);
+    ASSERT_TRUE(stack <= copy);
+
+    auto moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(moved.top(), 9);
+    copy = moved;
+    ASSERT_TRUE(copy == moved);
+    stack = std::move(moved);
+    ASSERT_EQ(stack.top(), 9);
+
+    swap(stack, copy);
+    ASSERT_TRUE(stack == copy);
+}
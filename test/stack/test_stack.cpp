@@ -1,11 +1,27 @@
 #include <deque>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <sstream>
 #include <stack>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 #include "stack/Stack.h"
 
+namespace
+{
+// Exposes the underlying container to check capacity and which path a bulk call took
+template<typename T, typename Container = stlcontainer::Vector<T>>
+struct InspectableStack : stlcontainer::Stack<T, Container>
+{
+    Container& container() { return this->_container; }
+};
+}
+
 TEST(STACK, EMPTY_CREATION_DEFAULT_CONSTRUCTOR)
 {
     stlcontainer::Stack<int> stack;
@@ -21,7 +37,7 @@ TEST(STACK, EMPTY_CREATION_DEFAULT_CONSTRUCTOR)
 TEST(STACK, COPY_CONTAINER_CONSTRUCTOR)
 {
     std::deque<int> d = {9,5,6};
-    stlcontainer::Stack<int> stack(d);
+    stlcontainer::Stack<int, std::deque<int>> stack(d);
     std::stack<int> stackCompare(d);
     ASSERT_EQ(stack.size(), stackCompare.size());
 }
@@ -29,7 +45,7 @@ TEST(STACK, COPY_CONTAINER_CONSTRUCTOR)
 TEST(STACK, MOVE_CONTAINER_CONSTRUCTOR)
 {
     std::deque<int> d = {9,5,6};
-    stlcontainer::Stack<int> stack(std::move(d));
+    stlcontainer::Stack<int, std::deque<int>> stack(std::move(d));
     std::stack<int> stackCompare(std::move(d));
     
     // stack already took all of d's resources, so size of stack should be 3 and size of stackCompare should be 0
@@ -224,4 +240,110 @@ TEST(STACK, CONTAINER_VARIATIONS)
     std::stack<char, std::deque<char>> stackDequeCompare({'8','4','5','6'});
     ASSERT_EQ(stackDeque.size(), stackDequeCompare.size());   
     ASSERT_EQ(stackDeque.top(), stackDequeCompare.top());
-}
\ No newline at end of file
+}
+TEST(STACK, DEFAULT_CONTAINER_IS_VECTOR)
+{
+    static_assert(std::is_same<stlcontainer::Stack<int>::container_type, stlcontainer::Vector<int>>::value,
+        "Stack defaults to contiguous storage");
+
+    stlcontainer::Stack<std::string> stack;
+    stack.push("a");
+    stack.push(std::string(3, 'b'));
+    ASSERT_EQ(stack.size(), 2);
+    ASSERT_EQ(stack.top(), "bbb");
+    stack.pop();
+    ASSERT_EQ(stack.top(), "a");
+    stack.pop();
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(STACK, EMPLACE_MOVE_ONLY)
+{
+    stlcontainer::Stack<std::unique_ptr<int>> stack;
+    stack.emplace(new int(1));
+    stack.push(std::unique_ptr<int>(new int(2)));
+    ASSERT_EQ(*stack.top(), 2);
+    stack.pop();
+    ASSERT_EQ(*stack.top(), 1);
+}
+
+TEST(STACK, RESERVE)
+{
+    InspectableStack<int> stack;
+    stack.reserve(100);
+    ASSERT_EQ(stack.container().capacity(), 100);
+    auto storage = stack.container().data();
+    for (int index = 0; index < 100; ++index)
+    {
+        stack.push(index);
+    }
+    ASSERT_EQ(stack.container().data(), storage);
+
+    // Containers without reserve ignore it
+    stlcontainer::Stack<int, std::deque<int>> dequeStack;
+    dequeStack.reserve(100);
+    ASSERT_TRUE(dequeStack.empty());
+}
+
+TEST(STACK, PUSH_RANGE)
+{
+    InspectableStack<int> stack;
+    std::list<int> values = {1, 2, 3, 4, 5};
+    stack.push_range(values.begin(), values.end());
+    ASSERT_EQ(stack.size(), 5);
+    ASSERT_EQ(stack.top(), 5);
+    ASSERT_EQ(stack.container().capacity(), 5);
+
+    // Small batches still grow geometrically
+    int more[] = {6};
+    stack.push_range(more, more + 1);
+    ASSERT_EQ(stack.container().capacity(), 10);
+
+    // Single-pass input
+    std::istringstream input("7 8 9");
+    stack.push_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    ASSERT_EQ(stack.size(), 9);
+    ASSERT_EQ(stack.top(), 9);
+
+    stlcontainer::Stack<int, std::list<int>> listStack;
+    listStack.push_range(values.begin(), values.end());
+    ASSERT_EQ(listStack.top(), 5);
+}
+
+TEST(STACK, POP_N)
+{
+    stlcontainer::Stack<int> stack;
+    for (int index = 0; index < 5; ++index)
+    {
+        stack.push(index);
+    }
+    std::vector<int> popped;
+    ASSERT_EQ(stack.pop_n(std::back_inserter(popped), 3), 3);
+    ASSERT_EQ(popped, std::vector<int>({4, 3, 2}));
+    ASSERT_EQ(stack.top(), 1);
+
+    ASSERT_EQ(stack.pop_n(std::back_inserter(popped), 10), 2);
+    ASSERT_EQ(popped, std::vector<int>({4, 3, 2, 1, 0}));
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(stack.pop_n(std::back_inserter(popped), 1), 0);
+}
+
+TEST(STACK, ASSIGN_FROM_CONTAINER)
+{
+    stlcontainer::Stack<int> stack;
+    stlcontainer::Vector<int> values = {1, 2, 3};
+    stack = values;
+    ASSERT_EQ(stack.size(), 3);
+    ASSERT_EQ(stack.top(), 3);
+    ASSERT_EQ(values.size(), 3);
+
+    auto storage = values.data();
+    stack = std::move(values);
+    InspectableStack<int> inspect;
+    static_cast<stlcontainer::Stack<int>&>(inspect) = std::move(stack);
+    ASSERT_EQ(inspect.container().data(), storage);
+    ASSERT_EQ(inspect.top(), 3);
+
+    static_assert(std::is_nothrow_move_assignable<stlcontainer::Stack<int>>::value, "moving a stack must not throw");
+    static_assert(std::is_nothrow_move_constructible<stlcontainer::Stack<int>>::value, "moving a stack must not throw");
+}
@@ -0,0 +1,212 @@
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "stack/StaticStack.h"
+#include "../Counted.h"
+
+namespace
+{
+template<typename T, size_t N>
+using SpillingStack = stlcontainer::StaticStack<T, N, stlcontainer::StaticStackSpillToHeap<T>>;
+}
+
+TEST(STATIC_STACK, PUSH_TOP_POP)
+{
+    stlcontainer::StaticStack<int, 4> stack;
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(stack.capacity(), 4u);
+    ASSERT_FALSE(stack.spilled());
+
+    stack.push(1);
+    stack.push(2);
+    stack.emplace(3);
+    ASSERT_EQ(stack.size(), 3u);
+    ASSERT_EQ(stack.top(), 3);
+    stack.top() = 30;
+    ASSERT_EQ(stack.top(), 30);
+
+    stack.pop();
+    ASSERT_EQ(stack.top(), 2);
+    stack.pop();
+    stack.pop();
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(STATIC_STACK, OVERFLOW_THROWS_AND_LEAVES_STACK_UNCHANGED)
+{
+    stlcontainer::StaticStack<int, 2> stack;
+    stack.push(1);
+    stack.push(2);
+    ASSERT_THROW(stack.push(3), std::length_error);
+    ASSERT_THROW(stack.reserve(3), std::length_error);
+    ASSERT_EQ(stack.size(), 2u);
+    ASSERT_EQ(stack.top(), 2);
+
+    // A measurable range is checked before anything is pushed
+    std::vector<int> range = {3, 4};
+    stack.pop();
+    ASSERT_THROW(stack.push_range(range.begin(), range.end()), std::length_error);
+    ASSERT_EQ(stack.size(), 1u);
+    ASSERT_EQ(stack.top(), 1);
+}
+
+TEST(STATIC_STACK, TRY_PUSH_REPORTS_FULL)
+{
+    stlcontainer::StaticStack<std::unique_ptr<int>, 2> stack;
+    ASSERT_TRUE(stack.try_push(std::unique_ptr<int>(new int(1))));
+    ASSERT_TRUE(stack.try_emplace(new int(2)));
+
+    std::unique_ptr<int> rejected(new int(3));
+    ASSERT_FALSE(stack.try_push(std::move(rejected)));
+    ASSERT_TRUE(rejected != nullptr);
+    ASSERT_EQ(stack.size(), 2u);
+    ASSERT_EQ(*stack.top(), 2);
+
+    // A spilling stack does not spill through try_push either
+    SpillingStack<int, 1> spilling;
+    ASSERT_TRUE(spilling.try_push(1));
+    ASSERT_FALSE(spilling.try_push(2));
+    ASSERT_FALSE(spilling.spilled());
+}
+
+TEST(STATIC_STACK, SPILLS_TO_HEAP_AND_KEEPS_ORDER)
+{
+    SpillingStack<std::string, 3> stack;
+    for (int index = 0; index < 100; ++index)
+    {
+        stack.push(std::to_string(index));
+        if (index == 2)
+        {
+            ASSERT_FALSE(stack.spilled());
+        }
+    }
+    ASSERT_TRUE(stack.spilled());
+    ASSERT_GE(stack.capacity(), 100u);
+    ASSERT_EQ(stack.size(), 100u);
+
+    for (int index = 99; index >= 0; --index)
+    {
+        ASSERT_EQ(stack.top(), std::to_string(index));
+        stack.pop();
+    }
+    ASSERT_TRUE(stack.empty());
+
+    // Pushing an element of the stack itself while it spills
+    SpillingStack<std::string, 1> self;
+    self.push("top");
+    self.push(self.top());
+    ASSERT_EQ(self.top(), "top");
+}
+
+TEST(STATIC_STACK, ELEMENT_LIFETIMES)
+{
+    Counted::live = 0;
+    {
+        stlcontainer::StaticStack<Counted, 8> stack;
+        ASSERT_EQ(Counted::live, 0);
+        for (int index = 0; index < 5; ++index)
+        {
+            stack.emplace(index);
+        }
+        ASSERT_EQ(Counted::live, 5);
+        stack.pop();
+        ASSERT_EQ(Counted::live, 4);
+
+        SpillingStack<Counted, 2> spilling;
+        for (int index = 0; index < 10; ++index)
+        {
+            spilling.push(Counted(index));
+        }
+        ASSERT_EQ(Counted::live, 14);
+        spilling.clear();
+        ASSERT_EQ(Counted::live, 4);
+        ASSERT_TRUE(spilling.spilled());
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(STATIC_STACK, COPY_AND_MOVE)
+{
+    stlcontainer::StaticStack<std::string, 4> stack;
+    stack.push("a");
+    stack.push("b");
+
+    auto copy = stack;
+    ASSERT_TRUE(copy == stack);
+    auto moved = std::move(copy);
+    ASSERT_TRUE(moved == stack);
+    ASSERT_TRUE(copy.empty());
+
+    stlcontainer::StaticStack<std::string, 4> assigned;
+    assigned.push("z");
+    assigned = stack;
+    ASSERT_TRUE(assigned == stack);
+    assigned = std::move(moved);
+    ASSERT_TRUE(assigned == stack);
+
+    // Moving a spilled stack hands over its heap block
+    SpillingStack<int, 2> spilling;
+    for (int index = 0; index < 10; ++index)
+    {
+        spilling.push(index);
+    }
+    auto spilledCopy = spilling;
+    ASSERT_TRUE(spilledCopy == spilling);
+    auto taken = std::move(spilling);
+    ASSERT_TRUE(taken.spilled());
+    ASSERT_FALSE(spilling.spilled());
+    ASSERT_TRUE(spilling.empty());
+    ASSERT_TRUE(taken == spilledCopy);
+
+    SpillingStack<int, 2> small;
+    small.push(1);
+    taken = std::move(small);
+    ASSERT_EQ(taken.size(), 1u);
+    ASSERT_EQ(taken.top(), 1);
+}
+
+TEST(STATIC_STACK, RELATIONAL_OPERATORS_AND_SWAP)
+{
+    stlcontainer::StaticStack<int, 4> lhs;
+    stlcontainer::StaticStack<int, 4> rhs;
+    lhs.push(1);
+    lhs.push(2);
+    rhs.push(1);
+    rhs.push(3);
+
+    ASSERT_TRUE(lhs != rhs);
+    ASSERT_TRUE(lhs < rhs);
+    ASSERT_TRUE(rhs > lhs);
+    ASSERT_TRUE(lhs <= rhs);
+    ASSERT_FALSE(lhs >= rhs);
+
+    swap(lhs, rhs);
+    ASSERT_EQ(lhs.top(), 3);
+    ASSERT_EQ(rhs.top(), 2);
+}
+
+TEST(STATIC_STACK, PUSH_RANGE_AND_POP_N)
+{
+    SpillingStack<int, 4> stack;
+    std::vector<int> range = {1, 2, 3, 4, 5, 6};
+    stack.push_range(range.begin(), range.end());
+    ASSERT_TRUE(stack.spilled());
+    ASSERT_EQ(stack.size(), 6u);
+    ASSERT_EQ(stack.top(), 6);
+
+    std::istringstream input("7 8");
+    stack.push_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    ASSERT_EQ(stack.top(), 8);
+
+    std::vector<int> popped;
+    ASSERT_EQ(stack.pop_n(std::back_inserter(popped), 3), 3u);
+    ASSERT_EQ(popped, (std::vector<int>{8, 7, 6}));
+    ASSERT_EQ(stack.pop_n(std::back_inserter(popped), 10), 5u);
+    ASSERT_TRUE(stack.empty());
+}
@@ -0,0 +1,120 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "string/GlobSet.h"
+
+TEST(GLOB_SET, EMPTY_CREATION)
+{
+    stlcontainer::GlobSet globs;
+    ASSERT_TRUE(globs.empty());
+    ASSERT_EQ(globs.size(), 0);
+    ASSERT_TRUE(globs.match("anything").empty());
+    ASSERT_FALSE(globs.matches_any(""));
+}
+
+TEST(GLOB_SET, LITERAL)
+{
+    stlcontainer::GlobSet globs({"abc", "abd"});
+    ASSERT_EQ(globs.match("abc"), std::vector<size_t>({0}));
+    ASSERT_EQ(globs.match("abd"), std::vector<size_t>({1}));
+    ASSERT_TRUE(globs.match("ab").empty());
+    ASSERT_TRUE(globs.match("abcd").empty());
+}
+
+TEST(GLOB_SET, WILDCARDS)
+{
+    stlcontainer::GlobSet globs;
+    auto star = globs.add_glob("*");
+    auto suffix = globs.add_glob("*.cpp");
+    auto middle = globs.add_glob("test_*_list.?pp");
+    auto single = globs.add_glob("???");
+    auto stars = globs.add_glob("a**b***c");
+    auto empty = globs.add_glob("");
+
+    ASSERT_EQ(globs.size(), 6);
+    ASSERT_EQ(globs.match("test_forward_list.cpp"), std::vector<size_t>({star, suffix, middle}));
+    ASSERT_EQ(globs.match("test_forward_list.hpp"), std::vector<size_t>({star, middle}));
+    ASSERT_EQ(globs.match(".cpp"), std::vector<size_t>({star, suffix}));
+    ASSERT_EQ(globs.match("abc"), std::vector<size_t>({star, single, stars}));
+    ASSERT_EQ(globs.match("axxbyyc"), std::vector<size_t>({star, stars}));
+    ASSERT_EQ(globs.match(""), std::vector<size_t>({star, empty}));
+}
+
+TEST(GLOB_SET, BACKTRACKING)
+{
+    // Naive greedy matching fails these, the automaton tracks every split point at once
+    stlcontainer::GlobSet globs({"*aab", "a*a*a*b", "*ab*ab"});
+    ASSERT_EQ(globs.match("aaab"), std::vector<size_t>({0, 1}));
+    ASSERT_EQ(globs.match("aaaaab"), std::vector<size_t>({0, 1}));
+    ASSERT_EQ(globs.match("xabyyab"), std::vector<size_t>({2}));
+    ASSERT_EQ(globs.match("abab"), std::vector<size_t>({2}));
+    ASSERT_TRUE(globs.match("aab ").empty());
+}
+
+TEST(GLOB_SET, PREFIX)
+{
+    stlcontainer::GlobSet globs;
+    auto a = globs.add_prefix("stl");
+    auto b = globs.add_prefix("stlcontainer::");
+    auto literal = globs.add_prefix("a*?");
+    auto glob = globs.add_glob("*::String");
+
+    ASSERT_EQ(globs.match("stlcontainer::String"), std::vector<size_t>({a, b, glob}));
+    ASSERT_EQ(globs.match("stl"), std::vector<size_t>({a}));
+    ASSERT_EQ(globs.match("a*?b"), std::vector<size_t>({literal}));
+    ASSERT_TRUE(globs.match("abc").empty());
+    ASSERT_TRUE(globs.match("st").empty());
+}
+
+TEST(GLOB_SET, STRING_AND_BUFFER)
+{
+    stlcontainer::GlobSet globs;
+    globs.add_glob(stlcontainer::String("*list*"));
+    globs.add_prefix(stlcontainer::String("vec"));
+
+    ASSERT_TRUE(globs.matches_any(stlcontainer::String("forward_list")));
+    ASSERT_TRUE(globs.matches_any("vector"));
+    ASSERT_TRUE(globs.matches_any("vector_listing", 3));
+    ASSERT_FALSE(globs.matches_any("queue"));
+
+    std::vector<size_t> out;
+    globs.match("vec_list", 8, out);
+    ASSERT_EQ(out, std::vector<size_t>({0, 1}));
+    globs.match("queue", 5, out);
+    ASSERT_TRUE(out.empty());
+}
+
+TEST(GLOB_SET, ADD_AFTER_MATCH)
+{
+    stlcontainer::GlobSet globs({"a*"});
+    ASSERT_EQ(globs.match("ab"), std::vector<size_t>({0}));
+    ASSERT_GT(globs.cached_states(), 0);
+
+    globs.add_glob("*b");
+    ASSERT_EQ(globs.match("ab"), std::vector<size_t>({0, 1}));
+
+    globs.clear();
+    ASSERT_TRUE(globs.empty());
+    ASSERT_TRUE(globs.match("ab").empty());
+}
+
+TEST(GLOB_SET, CACHE_LIMIT)
+{
+    // Tiny cache forces flushes mid-match, results must not change
+    stlcontainer::GlobSet small(4);
+    stlcontainer::GlobSet large;
+    std::vector<std::string> patterns = {"*a?c*", "b*d", "?*?*?", "abc*", "*cba"};
+    for (const auto& pattern : patterns)
+    {
+        small.add_glob(pattern.c_str());
+        large.add_glob(pattern.c_str());
+    }
+
+    std::vector<std::string> inputs = {"abcd", "bxxd", "xxcba", "ab", "abcabcabc", "zazcz"};
+    for (const auto& input : inputs)
+    {
+        ASSERT_EQ(small.match(input.c_str()), large.match(input.c_str())) << input;
+        ASSERT_LE(small.cached_states(), 4);
+    }
+}
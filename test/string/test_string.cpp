@@ -895,7 +895,7 @@ TEST(STRING, COPY)
 {
     stlcontainer::String s("teststring");
     stlcontainer::String sCompare("tests");
-    char dest[100];
+    char dest[100] = {};
     s.copy(dest, 5, 0);
     stlcontainer::String sCopied(dest);
 
@@ -958,10 +958,67 @@ TEST(STRING, SWAP)
 // ------------------------------------------------------------------
 // Member Functions: Search
 // ------------------------------------------------------------------
-// TEST(STRING, FIND)
-// {
+TEST(STRING, FIND)
+{
+    stlcontainer::String s("teststring");
+    std::string sCompare("teststring");
+
+    ASSERT_EQ(s.find(stlcontainer::String("str")), sCompare.find(std::string("str")));
+    ASSERT_EQ(s.find("t"), sCompare.find("t"));
+    ASSERT_EQ(s.find("t", 1), sCompare.find("t", 1));
+    ASSERT_EQ(s.find("ingx", 0, 3), sCompare.find("ingx", 0, 3));
+    ASSERT_EQ(s.find('s'), sCompare.find('s'));
+    ASSERT_EQ(s.find('s', 3), sCompare.find('s', 3));
+    ASSERT_EQ(s.find(""), sCompare.find(""));
+    ASSERT_EQ(s.find("", 10), sCompare.find("", 10));
+    ASSERT_EQ(s.find("ringz"), sCompare.find("ringz"));
+    ASSERT_EQ(s.find('z'), sCompare.find('z'));
+    ASSERT_EQ(s.find("t", 11), sCompare.find("t", 11));
+}
 
-// }
+TEST(STRING, STARTS_WITH)
+{
+    stlcontainer::String s("teststring");
+
+    ASSERT_TRUE(s.starts_with(stlcontainer::String("test")));
+    ASSERT_TRUE(s.starts_with("teststring"));
+    ASSERT_TRUE(s.starts_with(""));
+    ASSERT_TRUE(s.starts_with("tex", 2));
+    ASSERT_TRUE(s.starts_with('t'));
+    ASSERT_FALSE(s.starts_with("string"));
+    ASSERT_FALSE(s.starts_with("teststrings"));
+    ASSERT_FALSE(s.starts_with('s'));
+    ASSERT_FALSE(stlcontainer::String().starts_with('t'));
+}
+
+TEST(STRING, ENDS_WITH)
+{
+    stlcontainer::String s("teststring");
+
+    ASSERT_TRUE(s.ends_with(stlcontainer::String("string")));
+    ASSERT_TRUE(s.ends_with("teststring"));
+    ASSERT_TRUE(s.ends_with(""));
+    ASSERT_TRUE(s.ends_with("ngx", 2));
+    ASSERT_TRUE(s.ends_with('g'));
+    ASSERT_FALSE(s.ends_with("test"));
+    ASSERT_FALSE(s.ends_with("xteststring"));
+    ASSERT_FALSE(s.ends_with('t'));
+    ASSERT_FALSE(stlcontainer::String().ends_with('g'));
+}
+
+TEST(STRING, CONTAINS)
+{
+    stlcontainer::String s("teststring");
+
+    ASSERT_TRUE(s.contains(stlcontainer::String("tstr")));
+    ASSERT_TRUE(s.contains("teststring"));
+    ASSERT_TRUE(s.contains(""));
+    ASSERT_TRUE(s.contains("ringx", 4));
+    ASSERT_TRUE(s.contains('r'));
+    ASSERT_FALSE(s.contains("tests "));
+    ASSERT_FALSE(s.contains("strings"));
+    ASSERT_FALSE(s.contains('x'));
+}
 
 // ------------------------------------------------------------------
 // Non-Member Functions
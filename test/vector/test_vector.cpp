@@ -1,10 +1,13 @@
 #include <algorithm>
 #include <exception>
+#include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
 #include "vector/Vector.h"
+#include "../Counted.h"
 
 TEST(VECTOR, EMPTY_CREATION)
 {
@@ -445,4 +448,98 @@ TEST(VECTOR, STDSORT)
     // {
     //     ASSERT_EQ(vec[index], compareVec[index]);
     // }
-}
\ No newline at end of file
+}
+
+TEST(VECTOR, ELEMENT_LIFETIMES)
+{
+    // Only constructed elements are alive: spare capacity holds no objects
+    Counted::live = 0;
+    {
+        stlcontainer::Vector<Counted> vec;
+        vec.reserve(16);
+        ASSERT_EQ(Counted::live, 0);
+        for (int index = 0; index < 20; ++index)
+        {
+            vec.push_back(Counted(index));
+        }
+        ASSERT_EQ(Counted::live, 20);
+        vec.pop_back();
+        vec.pop_back();
+        ASSERT_EQ(Counted::live, 18);
+        vec.resize(5);
+        ASSERT_EQ(Counted::live, 5);
+        ASSERT_EQ(vec.back().value, 4);
+
+        stlcontainer::Vector<Counted> copy(vec);
+        ASSERT_EQ(Counted::live, 10);
+        copy = vec;
+        ASSERT_EQ(Counted::live, 10);
+        copy.clear();
+        ASSERT_EQ(Counted::live, 5);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(VECTOR, PUSH_BACK_MOVES)
+{
+    stlcontainer::Vector<std::unique_ptr<int>> vec;
+    for (int index = 0; index < 10; ++index)
+    {
+        vec.push_back(std::unique_ptr<int>(new int(index)));
+    }
+    ASSERT_EQ(vec.size(), 10);
+    ASSERT_EQ(*vec.front(), 0);
+    ASSERT_EQ(*vec.back(), 9);
+
+    stlcontainer::Vector<std::string> strVec;
+    std::string value(100, 'x');
+    auto buffer = value.data();
+    strVec.push_back(std::move(value));
+    ASSERT_EQ(strVec.back().data(), buffer);
+}
+
+TEST(VECTOR, EMPLACE_BACK)
+{
+    stlcontainer::Vector<std::string> vec;
+    auto& added = vec.emplace_back(3, 'a');
+    ASSERT_EQ(added, "aaa");
+    ASSERT_EQ(&added, &vec.back());
+
+    // Copying an element of the vector itself while it has to grow
+    for (int index = 0; index < 10; ++index)
+    {
+        vec.emplace_back(vec.front());
+    }
+    ASSERT_EQ(vec.size(), 11);
+    ASSERT_EQ(vec.back(), "aaa");
+}
+
+TEST(VECTOR, REUSE_AFTER_CLEAR)
+{
+    stlcontainer::Vector<int> vec({3,5,6});
+    vec.clear();
+    ASSERT_EQ(vec.capacity(), 0);
+    vec.push_back(1);
+    vec.push_back(2);
+    ASSERT_EQ(vec.size(), 2);
+    ASSERT_EQ(vec[1], 2);
+
+    // Popping an empty vector does nothing
+    stlcontainer::Vector<int> empty;
+    empty.pop_back();
+    ASSERT_TRUE(empty.empty());
+}
+
+TEST(VECTOR, BEGIN_END)
+{
+    stlcontainer::Vector<int> vec({3,5,6,7,1});
+    ASSERT_EQ(*vec.begin(), 3);
+    ASSERT_EQ(*(vec.end() - 1), 1);
+
+    int sum = 0;
+    for (auto value : vec)
+    {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 22);
+}